@@ -61,6 +61,33 @@ ValidateKeySize(  //
   return false;
 }
 
+auto
+ValidatePayloadSize(  //
+    [[maybe_unused]] const char *flagname,
+    const uint64_t value)  //
+    -> bool
+{
+  if (value == 8) return true;
+
+  if (dbgroup::kUseIntegerKeys) {
+    std::cerr << "The payload size is invalid (only 8 is allowed for comparing with the SOTA "
+                 "indexes)."
+              << std::endl;
+    return false;
+  }
+
+  if (!dbgroup::kBuildLargePayloads) {
+    std::cerr << "The payload size is invalid (large payloads have not been built)." << std::endl;
+    return false;
+  }
+
+  if (value == 32 || value == 128 || value == 256 || value == 1024 || value == 4096) return true;
+  std::cerr << "The specified payload size is invalid (only 8, 32, 128, 256, 1024, and 4096 are "
+               "allowed)."
+            << std::endl;
+  return false;
+}
+
 auto
 ValidateRandomSeed(  //
     [[maybe_unused]] const char *flagname,
@@ -98,4 +125,109 @@ ValidateWorkload(  //
   return true;
 }
 
+auto
+ValidateTraceFile(  //
+    [[maybe_unused]] const char *flagname,
+    const std::string &trace)  //
+    -> bool
+{
+  if (trace.empty()) return true;
+
+  const auto abs_path = std::filesystem::absolute(trace);
+  if (!std::filesystem::exists(abs_path)) {
+    std::cerr << "The specified trace file does not exist." << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+auto
+ValidateDatasetFile(  //
+    [[maybe_unused]] const char *flagname,
+    const std::string &dataset)  //
+    -> bool
+{
+  if (dataset.empty()) return true;
+
+  if (!dbgroup::kUseIntegerKeys) {
+    std::cerr << "A dataset requires integer keys (i.e., comparing with the SOTA indexes)."
+              << std::endl;
+    return false;
+  }
+
+  const auto abs_path = std::filesystem::absolute(dataset);
+  if (!std::filesystem::exists(abs_path)) {
+    std::cerr << "The specified dataset does not exist." << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+auto
+ValidateVarLenKeys(  //
+    [[maybe_unused]] const char *flagname,
+    const bool use_var_len_keys)  //
+    -> bool
+{
+  if (use_var_len_keys && dbgroup::kUseIntegerKeys) {
+    std::cerr << "Variable-length keys cannot be used with the state-of-the-art indexes."
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+auto
+ValidateMaterializeKeys(  //
+    [[maybe_unused]] const char *flagname,
+    const bool materialize_keys)  //
+    -> bool
+{
+  if (materialize_keys && dbgroup::kUseIntegerKeys) {
+    std::cerr << "Integer keys are not required to be materialized." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+auto
+ValidateInterleavedReads(  //
+    const char *flagname,
+    const uint64_t value)  //
+    -> bool
+{
+  if (value > 0 && value <= dbgroup::kMaxInterleavedReadNum) return true;
+
+  std::cerr << "A value must be in [1, " << dbgroup::kMaxInterleavedReadNum << "] for "
+            << flagname << std::endl;
+  return false;
+}
+
+auto
+ValidateArrival(  //
+    [[maybe_unused]] const char *flagname,
+    const std::string &arrival)  //
+    -> bool
+{
+  if (arrival == "constant" || arrival == "poisson") return true;
+
+  std::cerr << "The arrival process is invalid (only constant and poisson are allowed)."
+            << std::endl;
+  return false;
+}
+
+auto
+ValidateNonNegative(  //
+    const char *flagname,
+    const double value)  //
+    -> bool
+{
+  if (value >= 0) return true;
+
+  std::cerr << "A value must be non-negative for " << flagname << std::endl;
+  return false;
+}
+
 #endif  // INDEX_BENCHMARK_CLA_VALIDATOR_HPP
@@ -0,0 +1,304 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_CLOSED_LOOP_BENCHMARKER_HPP
+#define INDEX_BENCHMARK_CLOSED_LOOP_BENCHMARKER_HPP
+
+// C++ standard libraries
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// local sources
+#include "common.hpp"
+#include "latency.hpp"
+
+namespace dbgroup
+{
+
+/**
+ * @brief A class for measuring throughput or latency in closed loops.
+ *
+ * Each worker issues the next operation just after the previous one completes.
+ * Operations are consumed from a stream that generates them chunk by chunk, so
+ * workers never materialize their whole operation-queues. In latency mode, each
+ * worker retains at most `kMaxLatencyNum` latencies sampled uniformly from its
+ * operations (i.e., reservoir sampling), and the latency of scan operations is
+ * also reported for each power-of-two range of scan lengths. The keys of a batch
+ * of multi reads are read at once, so they share the latency of the batch.
+ *
+ * @tparam Index_t a class of target indexes.
+ * @tparam OperationEngine_t a class to generate operation streams.
+ */
+template <class Index_t, class OperationEngine_t>
+class ClosedLoopBenchmarker
+{
+  /*############################################################################
+   * Type aliases
+   *##########################################################################*/
+
+  using Clock_t = std::chrono::steady_clock;
+
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  ClosedLoopBenchmarker(  //
+      Index_t &index,
+      std::string target_name,
+      OperationEngine_t &ops_engine,
+      const size_t exec_num,
+      const size_t thread_num,
+      const size_t random_seed,
+      const bool measure_throughput,
+      const double record_size,
+      const bool output_as_csv,
+      const bool output_bytes,
+      const size_t timeout_in_sec)
+      : index_{index},
+        target_name_{std::move(target_name)},
+        ops_engine_{ops_engine},
+        exec_num_{exec_num},
+        thread_num_{thread_num},
+        random_seed_{random_seed},
+        measure_throughput_{measure_throughput},
+        record_size_{record_size},
+        output_as_csv_{output_as_csv},
+        output_bytes_{output_bytes},
+        timeout_{std::chrono::seconds{timeout_in_sec}}
+  {
+  }
+
+  ClosedLoopBenchmarker(const ClosedLoopBenchmarker &) = delete;
+  ClosedLoopBenchmarker(ClosedLoopBenchmarker &&) = delete;
+
+  auto operator=(const ClosedLoopBenchmarker &) -> ClosedLoopBenchmarker & = delete;
+  auto operator=(ClosedLoopBenchmarker &&) -> ClosedLoopBenchmarker & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~ClosedLoopBenchmarker() = default;
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Execute operations in all the workers and output the results.
+   *
+   */
+  void
+  Run()
+  {
+    std::vector<size_t> exec_nums(thread_num_, 0);
+    std::vector<Latencies_t> latencies(thread_num_);
+    std::vector<std::vector<Latencies_t>> scan_latencies(thread_num_);
+    std::vector<std::vector<size_t>> scan_nums(thread_num_);
+    std::atomic_size_t ready_num{0};
+    std::atomic_bool is_running{false};
+    std::atomic_bool is_timed_out{false};
+    Clock_t::time_point start{};
+
+    // a lambda function to execute operations in each worker
+    auto worker = [&](const size_t i, const size_t seed) {
+      std::mt19937_64 rand_engine{seed};
+      auto &&stream = ops_engine_.GenerateStream(exec_num_, rand_engine());
+      Latencies_t lat{};
+      std::vector<Latencies_t> scan_lat(kScanBucketNum);
+      std::vector<size_t> scan_num(kScanBucketNum, 0);
+      size_t count = 0;
+      size_t measured_num = 0;
+
+      index_.SetUpForWorker();
+      ready_num.fetch_add(1);
+      while (!is_running.load()) {
+        std::this_thread::yield();
+      }
+
+      stream.ForEachChunk([&](const auto *ops, const size_t n) {
+        if (measure_throughput_) {
+          count += index_.ExecuteAll(ops, n, stream.GetSingleOperation());
+        } else {
+          for (size_t j = 0; j < n;) {
+            const auto m = Index_t::GetUnitSize(&(ops[j]), n - j);
+            const auto op_start = Clock_t::now();
+            count += (m > 1) ? index_.ExecuteAll(&(ops[j]), m, kMultiRead) : index_.Execute(ops[j]);
+            const auto latency = std::chrono::nanoseconds{Clock_t::now() - op_start}.count();
+            for (size_t k = 0; k < m; ++k) {
+              SampleLatency(lat, latency, measured_num++, rand_engine);
+            }
+            const auto type = ops[j].GetType();
+            if (type == kScan || type == kRangeScan || type == kReverseScan) {
+              const auto b = GetScanBucket(ops[j].GetValue());
+              SampleLatency(scan_lat[b], latency, scan_num[b]++, rand_engine);
+            }
+            j += m;
+          }
+        }
+        if (Clock_t::now() - start <= timeout_) return true;
+        is_timed_out.store(true, std::memory_order_relaxed);
+        return false;
+      });
+      index_.TearDownForWorker();
+      exec_nums.at(i) = count;
+      latencies.at(i) = std::move(lat);
+      scan_latencies.at(i) = std::move(scan_lat);
+      scan_nums.at(i) = std::move(scan_num);
+    };
+
+    // prepare workers and start them at the same time
+    if (!output_as_csv_) {
+      std::cout << "...Prepare workers for benchmarking." << std::endl;
+    }
+    std::mt19937_64 rand_engine{random_seed_};
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < thread_num_; ++i) {
+      threads.emplace_back(worker, i, rand_engine());
+    }
+    while (ready_num.load() < thread_num_) {
+      std::this_thread::yield();
+    }
+    if (!output_as_csv_) {
+      std::cout << "...Run workers." << std::endl;
+    }
+    start = Clock_t::now();
+    is_running.store(true);
+    for (auto &&t : threads) {
+      t.join();
+    }
+    const auto elapsed = std::chrono::duration<double>{Clock_t::now() - start}.count();
+    if (is_timed_out.load() && !output_as_csv_) {
+      std::cout << "NOTE: the timeout stopped workers before all the operations." << std::endl;
+    }
+
+    // output the results
+    if (measure_throughput_) {
+      size_t total = 0;
+      for (const auto count : exec_nums) {
+        total += count;
+      }
+      OutputThroughput(total / elapsed);
+    } else {
+      Latencies_t merged{};
+      std::vector<Latencies_t> scan_merged(kScanBucketNum);
+      std::vector<size_t> scan_merged_nums(kScanBucketNum, 0);
+      for (size_t i = 0; i < thread_num_; ++i) {
+        merged.insert(merged.end(), latencies[i].begin(), latencies[i].end());
+        for (size_t b = 0; b < kScanBucketNum; ++b) {
+          const auto &lat = scan_latencies[i][b];
+          scan_merged[b].insert(scan_merged[b].end(), lat.begin(), lat.end());
+          scan_merged_nums[b] += scan_nums[i][b];
+        }
+      }
+      OutputLatency(merged);
+      if (!output_as_csv_) {
+        OutputScanLatencies(scan_merged_nums, scan_merged);
+      }
+    }
+  }
+
+ private:
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  void
+  OutputThroughput(const double throughput) const
+  {
+    if (output_as_csv_) {
+      std::cout << throughput;
+      if (output_bytes_) {
+        std::cout << "," << throughput * record_size_;
+      }
+      std::cout << std::endl;
+    } else {
+      std::cout << "*** RESULTS ***" << std::endl
+                << target_name_ << ": " << throughput << " ops/s (" << throughput * record_size_
+                << " bytes/s)" << std::endl;
+    }
+  }
+
+  void
+  OutputLatency(Latencies_t &latencies) const
+  {
+    const auto &percentiles = ComputePercentiles(latencies);
+    if (!output_as_csv_) {
+      std::cout << "*** RESULTS ***" << std::endl
+                << target_name_ << std::endl
+                << "  Percentiled latencies [ns]:" << std::endl;
+    }
+    for (size_t i = 0; i < percentiles.size(); ++i) {
+      if (output_as_csv_) {
+        std::cout << ((i == 0) ? "" : ",") << percentiles[i];
+      } else {
+        std::cout << "    " << kPercentileLabels[i] << ": " << percentiles[i] << std::endl;
+      }
+    }
+    if (output_as_csv_) {
+      std::cout << std::endl;
+    }
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// a target index.
+  Index_t &index_;
+
+  /// the name of a target index.
+  std::string target_name_{};
+
+  /// an engine to generate operation streams.
+  OperationEngine_t &ops_engine_;
+
+  /// the number of operations for each worker.
+  size_t exec_num_{0};
+
+  /// the number of worker threads.
+  size_t thread_num_{1};
+
+  /// a random seed to generate workloads.
+  size_t random_seed_{0};
+
+  /// a flag for measuring throughput instead of latency.
+  bool measure_throughput_{true};
+
+  /// the average number of bytes of a record to report throughput in bytes/s.
+  double record_size_{0};
+
+  /// a flag for outputting results in CSV format.
+  bool output_as_csv_{false};
+
+  /// a flag for appending throughput in bytes/s to CSV results.
+  bool output_bytes_{false};
+
+  /// the maximum duration of executing operations.
+  std::chrono::nanoseconds timeout_{};
+};
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_CLOSED_LOOP_BENCHMARKER_HPP
@@ -18,6 +18,7 @@
 #define INDEX_BENCHMARK_COMMON_HPP
 
 // C++ standard libraries
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -26,12 +27,15 @@
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 // external sources
 #include "nlohmann/json.hpp"
 
 // local sources
+#include "key_arena.hpp"
+#include "key_dataset.hpp"
 #include "var_len_data.hpp"
 
 namespace dbgroup
@@ -58,6 +62,10 @@ enum IndexOperation {
   kDeleteAndInsert,
   kDeleteOrInsert,
   kInsertAndDelete,
+  kReadModifyWrite,
+  kRangeScan,
+  kReverseScan,
+  kMultiRead,
   kOpsNum,
 };
 
@@ -76,6 +84,10 @@ NLOHMANN_JSON_SERIALIZE_ENUM(IndexOperation,
                                  {kDeleteAndInsert, "delete and insert"},
                                  {kDeleteOrInsert, "delete or insert"},
                                  {kInsertAndDelete, "insert and delete"},
+                                 {kReadModifyWrite, "read modify write"},
+                                 {kRangeScan, "range scan"},
+                                 {kReverseScan, "reverse scan"},
+                                 {kMultiRead, "multi read"},
                              })
 
 enum AccessPattern {
@@ -83,6 +95,7 @@ enum AccessPattern {
   kRandom,
   kAscending,
   kDescending,
+  kLatest,
 };
 
 // mapping for access pattern strings
@@ -92,6 +105,7 @@ NLOHMANN_JSON_SERIALIZE_ENUM(AccessPattern,
                                  {kRandom, "random"},
                                  {kAscending, "ascending"},
                                  {kDescending, "descending"},
+                                 {kLatest, "latest"},
                              })
 
 enum Partitioning {
@@ -122,6 +136,19 @@ enum KeySize {
   k128 = 128,
 };
 
+/**
+ * @brief A list of the size of target payloads.
+ *
+ */
+enum PayloadSize {
+  kPayload8 = 8,
+  kPayload32 = 32,
+  kPayload128 = 128,
+  kPayload256 = 256,
+  kPayload1K = 1024,
+  kPayload4K = 4096,
+};
+
 constexpr int kSuccess = 0;
 
 constexpr int kFailed = -1;
@@ -130,6 +157,21 @@ constexpr size_t kMaxCoreNum = INDEX_BENCH_MAX_CORES;
 
 constexpr size_t kScanSize = 128;
 
+/// the number of bits to embed a written value or a scan length into an operation.
+constexpr size_t kOpsValueBitNum = 28;
+
+/// the maximum scan length that can be embedded into an operation.
+constexpr size_t kMaxScanLength = (1UL << kOpsValueBitNum) - 1UL;
+
+/// the maximum value written by operations (written values are in [0, kMaxWrittenValue]).
+constexpr size_t kMaxWrittenValue = 256;
+
+/// the maximum number of keys in a batch of multi reads.
+constexpr size_t kMaxMultiReadSize = 256;
+
+/// the maximum number of point reads that a worker keeps in flight.
+constexpr size_t kMaxInterleavedReadNum = 64;
+
 constexpr bool kClosed = true;
 
 constexpr bool kUseBulkload = true;
@@ -140,6 +182,12 @@ constexpr bool kBuildLongKeys = true;
 constexpr bool kBuildLongKeys = false;
 #endif
 
+#ifdef INDEX_BENCH_BUILD_LARGE_PAYLOADS
+constexpr bool kBuildLargePayloads = true;
+#else
+constexpr bool kBuildLargePayloads = false;
+#endif
+
 #ifdef INDEX_BENCH_COMPARE_WITH_SOTA
 constexpr bool kUseIntegerKeys = true;
 #else
@@ -161,6 +209,172 @@ AlmostEqual(  //
   return fabs(a - b) <= kEpsilon;
 }
 
+/**
+ * @brief Prevent compilers from removing the computation of a given value.
+ *
+ * Results of operations (e.g., read payloads) are not used by benchmarks, so
+ * inlined index code could be optimized away without this barrier.
+ *
+ * @param val a value to be kept.
+ */
+template <class T>
+inline void
+DoNotOptimize(const T &val)
+{
+  asm volatile("" : : "r,m"(val) : "memory");
+}
+
+/// a type to refer keys (materialized fixed-length keys are referred without copies).
+template <class Key>
+using KeyRef_t = std::conditional_t<std::is_class_v<Key>, const Key &, Key>;
+
+/// a type to refer payloads (prebuilt class payloads are referred without copies).
+template <class Payload>
+using PayloadRef_t = std::conditional_t<std::is_class_v<Payload>, const Payload &, Payload>;
+
+/**
+ * @tparam Key a class of target keys.
+ * @param id a key ID.
+ * @return the key of the given ID built from a dataset if loaded (only for integer keys).
+ */
+template <class Key>
+auto
+BuildKey(const KeyID id)  //
+    -> Key
+{
+  if constexpr (std::is_integral_v<Key>) {
+    if (const auto *dataset = KeyDataset::Get(); dataset != nullptr) {
+      return dataset->GetKey<Key>(id);
+    }
+  }
+  return static_cast<Key>(id);
+}
+
+/**
+ * @tparam Key a class of target keys.
+ * @param id a key ID.
+ * @return the key of the given ID (taken from a key arena or a dataset if used).
+ * @note Fixed-length class keys that are not materialized are built in a
+ * thread-local buffer, which is reused after `kBufNum` calls.
+ */
+template <class Key>
+auto
+ToKey(const KeyID id)  //
+    -> KeyRef_t<Key>
+{
+  if constexpr (IsVarLenKey<Key>()) {
+    return KeyArena::Get()->GetKey(id);
+  } else if constexpr (std::is_class_v<Key>) {
+    if (const auto *arena = FixedLenKeyArena<Key>::Get(); arena && id < arena->GetKeyNum()) {
+      return arena->GetKey(id);
+    }
+    constexpr size_t kBufNum = 4;
+    thread_local std::array<Key, kBufNum> buf{};
+    thread_local size_t pos = 0;
+    auto &key = buf[pos++ % kBufNum];
+    key = BuildKey<Key>(id);
+    return key;
+  } else {
+    return BuildKey<Key>(id);
+  }
+}
+
+/**
+ * @tparam Key a class of target keys.
+ * @param id a key ID.
+ * @return the length of the key of the given ID.
+ */
+template <class Key>
+auto
+ToKeyLength([[maybe_unused]] const KeyID id)  //
+    -> size_t
+{
+  if constexpr (IsVarLenKey<Key>()) {
+    return KeyArena::Get()->GetKeyLength(id);
+  } else {
+    return sizeof(Key);
+  }
+}
+
+/**
+ * @tparam Payload a class of target payloads.
+ * @param payload a payload.
+ * @return the value that the payload was generated from.
+ */
+template <class Payload>
+constexpr auto
+GetPayloadValue(const Payload &payload)  //
+    -> size_t
+{
+  if constexpr (std::is_integral_v<Payload>) {
+    return static_cast<size_t>(payload);
+  } else {
+    return payload.GetValue();
+  }
+}
+
+/**
+ * @brief Build the payloads of all the written values once.
+ *
+ * Constructing a payload such as `VarLenData` costs a few `memset`s, so calling
+ * this function before benchmarking removes the cost from measured regions.
+ *
+ * @tparam Payload a class of target payloads.
+ * @return the payloads of values in [0, kMaxWrittenValue].
+ */
+template <class Payload>
+auto
+GetPayloads()  //
+    -> const std::vector<Payload> &
+{
+  static const std::vector<Payload> payloads = [] {
+    std::vector<Payload> vec{};
+    vec.reserve(kMaxWrittenValue + 1);
+    for (size_t val = 0; val <= kMaxWrittenValue; ++val) {
+      vec.emplace_back(static_cast<uint32_t>(val));
+    }
+    return vec;
+  }();
+  return payloads;
+}
+
+/**
+ * @tparam Payload a class of target payloads.
+ * @param val a written value.
+ * @return the payload of the given value (taken from prebuilt ones if possible).
+ */
+template <class Payload>
+auto
+ToPayload(const uint32_t val)  //
+    -> PayloadRef_t<Payload>
+{
+  if constexpr (std::is_class_v<Payload>) {
+    if (val <= kMaxWrittenValue) return GetPayloads<Payload>()[val];
+    thread_local Payload payload{};
+    payload = Payload{val};
+    return payload;
+  } else {
+    return Payload{val};
+  }
+}
+
+/**
+ * @tparam Key a class of target keys.
+ * @tparam Payload a class of target payloads.
+ * @return the average number of bytes of a record.
+ */
+template <class Key, class Payload>
+auto
+GetRecordSize()  //
+    -> double
+{
+  if constexpr (IsVarLenKey<Key>()) {
+    return KeyArena::Get()->GetAverageKeyLength() + sizeof(Payload);
+  } else {
+    return sizeof(Key) + sizeof(Payload);
+  }
+}
+
 /**
  * @brief Create key/value entries for bulkloading.
  *
@@ -184,12 +398,14 @@ PrepareBulkLoadEntries(  //
   auto f = [&](const size_t begin_pos, const size_t n, const size_t thread_id) {
     const size_t end_pos = begin_pos + n;
     if (seed < 0) {
-      for (uint32_t i = begin_pos; i < end_pos; ++i) {
-        entries.at(i) = {Key{i}, Payload{i}};
+      for (size_t i = begin_pos; i < end_pos; ++i) {
+        const auto k = static_cast<KeyID>(i);
+        entries.at(i) = {ToKey<Key>(k), static_cast<Payload>(k)};
       }
     } else {
-      for (uint32_t i = begin_pos, k = thread_id; i < end_pos; ++i, k += thread_num) {
-        entries.at(i) = {Key{k}, Payload{k}};
+      auto k = static_cast<KeyID>(thread_id);
+      for (size_t i = begin_pos; i < end_pos; ++i, k += thread_num) {
+        entries.at(i) = {ToKey<Key>(k), static_cast<Payload>(k)};
       }
       auto &&begin_it = std::next(entries.begin(), begin_pos);
       auto &&end_it = std::next(begin_it, n);
@@ -220,6 +436,67 @@ HasSetUpTearDown()  //
   return false;
 }
 
+/**
+ * @retval true if the index can stop a scan at a given end key.
+ * @retval false otherwise (i.e., range scans are not supported).
+ */
+template <template <class K, class V> class Index>
+constexpr auto
+HasEndKeyScan()  //
+    -> bool
+{
+  return true;
+}
+
+/**
+ * @retval true if the index provides `MultiRead` to read a batch of keys at once.
+ * @retval false otherwise (i.e., a batch is read by calling `Read` for each key).
+ */
+template <template <class K, class V> class Index>
+constexpr auto
+HasMultiRead()  //
+    -> bool
+{
+  return false;
+}
+
+/**
+ * @retval true if the index can interleave point reads (i.e., it provides
+ * `ReadInterleaved` to overlap the cache misses of multiple reads).
+ * @retval false otherwise.
+ */
+template <template <class K, class V> class Index>
+constexpr auto
+HasInterleavedRead()  //
+    -> bool
+{
+  return false;
+}
+
+/**
+ * @retval true if the index can scan records in descending order.
+ * @retval false otherwise.
+ */
+template <template <class K, class V> class Index>
+constexpr auto
+HasReverseScan()  //
+    -> bool
+{
+  return false;
+}
+
+/**
+ * @return the maximum number of records that the index can scan at once (the
+ * index cannot continue a scan beyond this length).
+ */
+template <template <class K, class V> class Index>
+constexpr auto
+GetMaxScanLength()  //
+    -> size_t
+{
+  return kMaxScanLength;
+}
+
 }  // namespace dbgroup
 
 #endif  // INDEX_BENCHMARK_COMMON_HPP
@@ -18,8 +18,14 @@
 #define INDEX_BENCHMARK_INDEX_HPP
 
 // C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iostream>
 #include <memory>
+#include <optional>
 #include <thread>
+#include <tuple>
 #include <vector>
 
 // external system libraries
@@ -156,6 +162,13 @@ class Index
   using Operation_t = Operation<Key, Payload>;
   using ConstIter_t = typename std::vector<std::pair<Key, Payload>>::const_iterator;
 
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// the number of point reads given to an index at once for interleaving.
+  static constexpr size_t kReadBlockSize = 4 * kMaxInterleavedReadNum;
+
  public:
   /*############################################################################
    * Public constructors and assignment operators
@@ -189,6 +202,25 @@ class Index
     }
   }
 
+  /**
+   * @brief Set the number of point reads that each worker keeps in flight.
+   *
+   * @param num the number of point reads in flight.
+   * @retval true if the target index can interleave point reads.
+   * @retval false otherwise (i.e., point reads are executed one by one).
+   */
+  auto
+  SetInterleavedReadNum(const size_t num)  //
+      -> bool
+  {
+    if constexpr (HasInterleavedRead<Implementation>() && !IsVarLenKey<Key>()) {
+      interleaved_read_num_ = num;
+      return true;
+    } else {
+      return num <= 1;
+    }
+  }
+
   void
   Construct(  //
       const std::vector<std::pair<Key, Payload>> &entries,
@@ -196,7 +228,19 @@ class Index
       const bool use_bulkload)
   {
     // if the target index has a bulkload function, use it
-    if (use_bulkload && (index_->Bulkload(entries, thread_num) == kSuccess)) return;
+    if constexpr (IsVarLenKey<Key>()) {
+      // variable-length keys are bulkloaded with their lengths
+      std::vector<std::tuple<Key, Payload, size_t>> var_entries{};
+      if (use_bulkload) {
+        var_entries.reserve(entries.size());
+        for (const auto &[key, payload] : entries) {
+          var_entries.emplace_back(key, payload, std::strlen(key) + 1);
+        }
+      }
+      if (use_bulkload && (index_->Bulkload(var_entries, thread_num) == kSuccess)) return;
+    } else {
+      if (use_bulkload && (index_->Bulkload(entries, thread_num) == kSuccess)) return;
+    }
 
     // otherwise, construct an index with one-by-one writing
     auto f = [&](ConstIter_t iter, const ConstIter_t &end_it) {
@@ -204,7 +248,11 @@ class Index
       SetUpForWorker();
       for (; iter != end_it; ++iter) {
         const auto &[key, payload] = *iter;
-        index_->Write(key, payload);
+        if constexpr (IsVarLenKey<Key>()) {
+          Write(key, payload, std::strlen(key) + 1);
+        } else {
+          Write(key, payload, sizeof(Key));
+        }
       }
       TearDownForWorker();
     };
@@ -228,77 +276,126 @@ class Index
   Execute(const Operation_t &ops)  //
       -> size_t
   {
-    switch (ops.type) {
-      case kScan: {
-        const auto &begin_k = std::make_tuple(ops.GetKey(), sizeof(Key), kClosed);
-        const size_t scan_size = ops.GetPayload();
-        size_t sum{0};
-        size_t count{0};
-        for (auto &&iter = index_->Scan(begin_k); iter && count < scan_size; ++iter, ++count) {
-          sum += iter.GetPayload();
-        }
-
-        return count;
-      }
-
-      case kFullScan: {
-        size_t sum{0};
-        size_t count{0};
-        for (auto &&iter = index_->Scan(); iter; ++iter, ++count) {
-          sum += iter.GetPayload();
-        }
-
-        return count;
-      }
-
+    switch (ops.GetType()) {
       case kRead:
-        index_->Read(ops.GetKey());
-        break;
-
+        return ExecuteAs<kRead>(ops);
+      case kScan:
+        return ExecuteAs<kScan>(ops);
+      case kFullScan:
+        return ExecuteAs<kFullScan>(ops);
       case kWrite:
-        index_->Write(ops.GetKey(), ops.GetPayload());
-        break;
-
+        return ExecuteAs<kWrite>(ops);
       case kInsert:
-        index_->Insert(ops.GetKey(), ops.GetPayload());
-        break;
-
+        return ExecuteAs<kInsert>(ops);
       case kUpdate:
-        index_->Update(ops.GetKey(), ops.GetPayload());
-        break;
-
+        return ExecuteAs<kUpdate>(ops);
       case kDelete:
-        index_->Delete(ops.GetKey());
-        break;
-
+        return ExecuteAs<kDelete>(ops);
       case kInsertOrUpdate:
-        if (index_->Insert(ops.GetKey(), ops.GetPayload())) {
-          index_->Update(ops.GetKey(), ops.GetPayload());
-        }
-        break;
-
+        return ExecuteAs<kInsertOrUpdate>(ops);
       case kDeleteAndInsert:
-        index_->Delete(ops.GetKey());
-        index_->Insert(ops.GetKey(), ops.GetPayload());
-        break;
-
+        return ExecuteAs<kDeleteAndInsert>(ops);
       case kDeleteOrInsert:
-        if (index_->Delete(ops.GetKey())) {
-          index_->Insert(ops.GetKey(), ops.GetPayload());
-        }
-        break;
-
+        return ExecuteAs<kDeleteOrInsert>(ops);
       case kInsertAndDelete:
-        index_->Insert(ops.GetKey(), ops.GetPayload());
-        index_->Delete(ops.GetKey());
-        break;
-
+        return ExecuteAs<kInsertAndDelete>(ops);
+      case kReadModifyWrite:
+        return ExecuteAs<kReadModifyWrite>(ops);
+      case kRangeScan:
+        return ExecuteAs<kRangeScan>(ops);
+      case kReverseScan:
+        return ExecuteAs<kReverseScan>(ops);
+      case kMultiRead:
+        return ExecuteAs<kMultiRead>(ops);
       default:
         std::string err_msg = "ERROR: an undefined operation is about to be executed.";
         throw std::runtime_error{err_msg};
     }
+  }
 
-    return 1;
+  /**
+   * @brief Execute a sequence of operations.
+   *
+   * If all the operations have the same type, this function dispatches them once
+   * to a loop specialized for the type instead of switching on each operation.
+   * The keys of a batch of multi reads are read at once.
+   *
+   * @param ops the head of operations.
+   * @param n the number of operations.
+   * @param single_ops the type of all the operations (`kUndefinedOperation` if mixed).
+   * @return the number of executed operations (scans count scanned records).
+   */
+  auto
+  ExecuteAll(  //
+      const Operation_t *ops,
+      const size_t n,
+      const IndexOperation single_ops)  //
+      -> size_t
+  {
+    switch (single_ops) {
+      case kRead:
+        return ExecuteAllAs<kRead>(ops, n);
+      case kScan:
+        return ExecuteAllAs<kScan>(ops, n);
+      case kFullScan:
+        return ExecuteAllAs<kFullScan>(ops, n);
+      case kWrite:
+        return ExecuteAllAs<kWrite>(ops, n);
+      case kInsert:
+        return ExecuteAllAs<kInsert>(ops, n);
+      case kUpdate:
+        return ExecuteAllAs<kUpdate>(ops, n);
+      case kDelete:
+        return ExecuteAllAs<kDelete>(ops, n);
+      case kInsertOrUpdate:
+        return ExecuteAllAs<kInsertOrUpdate>(ops, n);
+      case kDeleteAndInsert:
+        return ExecuteAllAs<kDeleteAndInsert>(ops, n);
+      case kDeleteOrInsert:
+        return ExecuteAllAs<kDeleteOrInsert>(ops, n);
+      case kInsertAndDelete:
+        return ExecuteAllAs<kInsertAndDelete>(ops, n);
+      case kReadModifyWrite:
+        return ExecuteAllAs<kReadModifyWrite>(ops, n);
+      case kRangeScan:
+        return ExecuteAllAs<kRangeScan>(ops, n);
+      case kReverseScan:
+        return ExecuteAllAs<kReverseScan>(ops, n);
+      case kMultiRead:
+        return ExecuteAllAs<kMultiRead>(ops, n);
+      default:
+        break;
+    }
+
+    size_t count{0};
+    for (size_t i = 0; i < n;) {
+      const auto m = GetUnitSize(&(ops[i]), n - i);
+      count += (m > 1) ? ExecuteAllAs<kMultiRead>(&(ops[i]), m) : Execute(ops[i]);
+      i += m;
+    }
+    return count;
+  }
+
+  /**
+   * @param ops the head of operations.
+   * @param n the number of operations.
+   * @return the number of leading operations to be executed as a unit (i.e., the
+   * keys of a batch of multi reads or one operation).
+   */
+  static auto
+  GetUnitSize(  //
+      const Operation_t *ops,
+      const size_t n)  //
+      -> size_t
+  {
+    if (ops[0].GetType() != kMultiRead) return 1;
+
+    // each multi read has the number of the remaining keys in its batch
+    const size_t batch_size = std::min<size_t>(ops[0].GetValue(), n);
+    for (size_t i = 1; i < batch_size; ++i) {
+      if (ops[i].GetType() != kMultiRead) return i;
+    }
+    return std::max<size_t>(batch_size, 1);
   }
 
   auto
@@ -321,12 +418,293 @@ class Index
   }
 
  private:
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  /**
+   * @tparam kOps the type of a given operation.
+   * @param ops an operation to be executed.
+   * @return the number of scanned records for scans, one otherwise.
+   */
+  template <IndexOperation kOps>
+  auto
+  ExecuteAs(const Operation_t &ops)  //
+      -> size_t
+  {
+    if constexpr (kOps == kScan) {
+      const auto &begin_k = std::make_tuple(ops.GetKey(), ops.GetKeyLength(), kClosed);
+      const size_t scan_size = ops.GetValue();
+      if (scan_size > GetMaxScanLength<Implementation>()) {
+        throw std::runtime_error{"ERROR: the target index does not support such long scans."};
+      }
+      size_t sum{0};
+      size_t count{0};
+      for (auto &&iter = index_->Scan(begin_k); iter && count < scan_size; ++iter, ++count) {
+        sum += GetPayloadValue(iter.GetPayload());
+      }
+
+      DoNotOptimize(sum);
+      return count;
+    } else if constexpr (kOps == kRangeScan) {
+      if constexpr (HasEndKeyScan<Implementation>()) {
+        const auto &begin_k = std::make_tuple(ops.GetKey(), ops.GetKeyLength(), kClosed);
+        const auto &end_k = std::make_tuple(ops.GetEndKey(), ops.GetEndKeyLength(), !kClosed);
+        size_t sum{0};
+        size_t count{0};
+        for (auto &&iter = index_->Scan(begin_k, end_k); iter; ++iter, ++count) {
+          sum += GetPayloadValue(iter.GetPayload());
+        }
+
+        DoNotOptimize(sum);
+        return count;
+      } else {
+        throw std::runtime_error{"ERROR: the target index does not support range scans."};
+      }
+    } else if constexpr (kOps == kReverseScan) {
+      if constexpr (HasReverseScan<Implementation>()) {
+        const auto &begin_k = std::make_tuple(ops.GetKey(), ops.GetKeyLength(), kClosed);
+        const size_t scan_size = ops.GetValue();
+        size_t sum{0};
+        size_t count{0};
+        for (auto &&iter = index_->ReverseScan(begin_k); iter && count < scan_size;
+             ++iter, ++count) {
+          sum += GetPayloadValue(iter.GetPayload());
+        }
+
+        DoNotOptimize(sum);
+        return count;
+      } else {
+        throw std::runtime_error{"ERROR: the target index does not support reverse scans."};
+      }
+    } else if constexpr (kOps == kFullScan) {
+      if constexpr (GetMaxScanLength<Implementation>() < kMaxScanLength) {
+        throw std::runtime_error{"ERROR: the target index does not support full scans."};
+      }
+      size_t sum{0};
+      size_t count{0};
+      for (auto &&iter = index_->Scan(); iter; ++iter, ++count) {
+        sum += GetPayloadValue(iter.GetPayload());
+      }
+
+      DoNotOptimize(sum);
+      return count;
+    } else {
+      if constexpr (kOps == kRead) {
+        DoNotOptimize(Read(ops.GetKey(), ops.GetKeyLength()));
+      } else if constexpr (kOps == kWrite) {
+        Write(ops.GetKey(), ops.GetPayload(), ops.GetKeyLength());
+      } else if constexpr (kOps == kInsert) {
+        Insert(ops.GetKey(), ops.GetPayload(), ops.GetKeyLength());
+      } else if constexpr (kOps == kUpdate) {
+        Update(ops.GetKey(), ops.GetPayload(), ops.GetKeyLength());
+      } else if constexpr (kOps == kDelete) {
+        Delete(ops.GetKey(), ops.GetKeyLength());
+      } else if constexpr (kOps == kInsertOrUpdate) {
+        const auto &key = ops.GetKey();
+        const auto key_len = ops.GetKeyLength();
+        if (Insert(key, ops.GetPayload(), key_len)) {
+          Update(key, ops.GetPayload(), key_len);
+        }
+      } else if constexpr (kOps == kDeleteAndInsert) {
+        const auto &key = ops.GetKey();
+        const auto key_len = ops.GetKeyLength();
+        Delete(key, key_len);
+        Insert(key, ops.GetPayload(), key_len);
+      } else if constexpr (kOps == kDeleteOrInsert) {
+        const auto &key = ops.GetKey();
+        const auto key_len = ops.GetKeyLength();
+        if (Delete(key, key_len)) {
+          Insert(key, ops.GetPayload(), key_len);
+        }
+      } else if constexpr (kOps == kInsertAndDelete) {
+        const auto &key = ops.GetKey();
+        const auto key_len = ops.GetKeyLength();
+        Insert(key, ops.GetPayload(), key_len);
+        Delete(key, key_len);
+      } else if constexpr (kOps == kReadModifyWrite) {
+        const auto &key = ops.GetKey();
+        const auto key_len = ops.GetKeyLength();
+        if (const auto &val = Read(key, key_len); val) {
+          Write(key, *val + ops.GetValue(), key_len);
+        }
+      } else if constexpr (kOps == kMultiRead) {
+        MultiRead(&ops, 1);
+      } else {
+        static_assert(kOps == kRead, "an undefined operation is given.");
+      }
+
+      return 1;
+    }
+  }
+
+  /**
+   * @brief Execute operations of the same type in a loop without any dispatching.
+   *
+   * @tparam kOps the type of all the operations.
+   */
+  template <IndexOperation kOps>
+  auto
+  ExecuteAllAs(  //
+      const Operation_t *ops,
+      const size_t n)  //
+      -> size_t
+  {
+    if constexpr (kOps == kScan || kOps == kRangeScan || kOps == kReverseScan
+                  || kOps == kFullScan) {
+      size_t count{0};
+      for (size_t i = 0; i < n; ++i) {
+        count += ExecuteAs<kOps>(ops[i]);
+      }
+      return count;
+    } else if constexpr (kOps == kMultiRead) {
+      for (size_t i = 0; i < n;) {
+        const auto m = GetUnitSize(&(ops[i]), n - i);
+        MultiRead(&(ops[i]), m);
+        i += m;
+      }
+      return n;
+    } else {
+      if constexpr (kOps == kRead && HasInterleavedRead<Implementation>()
+                    && !IsVarLenKey<Key>()) {
+        if (interleaved_read_num_ > 1) return ReadInterleaved(ops, n);
+      }
+      for (size_t i = 0; i < n; ++i) {
+        ExecuteAs<kOps>(ops[i]);
+      }
+      return n;
+    }
+  }
+
+  /**
+   * @brief Execute point reads with keeping multiple ones in flight.
+   *
+   */
+  auto
+  ReadInterleaved(  //
+      const Operation_t *ops,
+      const size_t n)  //
+      -> size_t
+  {
+    std::array<Key, kReadBlockSize> keys{};
+    std::array<std::optional<Payload>, kReadBlockSize> results{};
+    for (size_t i = 0; i < n; i += kReadBlockSize) {
+      const auto block_size = std::min(n - i, kReadBlockSize);
+      for (size_t j = 0; j < block_size; ++j) {
+        keys[j] = ops[i + j].GetKey();
+      }
+      index_->ReadInterleaved(keys.data(), block_size, results.data(), interleaved_read_num_);
+      DoNotOptimize(results);
+    }
+    return n;
+  }
+
+  /**
+   * @brief Read the keys of a batch of multi reads at once.
+   *
+   * @param ops the head of multi reads in a batch.
+   * @param n the number of keys in the batch.
+   */
+  void
+  MultiRead(  //
+      const Operation_t *ops,
+      const size_t n)
+  {
+    if constexpr (HasMultiRead<Implementation>() && !IsVarLenKey<Key>()) {
+      std::array<Key, kMaxMultiReadSize> keys{};
+      std::array<std::optional<Payload>, kMaxMultiReadSize> results{};
+      for (size_t i = 0; i < n; ++i) {
+        keys[i] = ops[i].GetKey();
+      }
+      index_->MultiRead(keys.data(), n, results.data());
+      for (size_t i = 0; i < n; ++i) {
+        DoNotOptimize(results[i]);
+      }
+    } else {
+      // otherwise, read keys one by one (variable-length keys may share a few buffers)
+      for (size_t i = 0; i < n; ++i) {
+        DoNotOptimize(Read(ops[i].GetKey(), ops[i].GetKeyLength()));
+      }
+    }
+  }
+
+  /*
+   * The following functions pass key lengths to indexes only if keys are
+   * variable-length because the other indexes do not receive them.
+   */
+
+  auto
+  Read(  //
+      const Key &key,
+      [[maybe_unused]] const size_t key_len)
+  {
+    if constexpr (IsVarLenKey<Key>()) {
+      return index_->Read(key, key_len);
+    } else {
+      return index_->Read(key);
+    }
+  }
+
+  auto
+  Write(  //
+      const Key &key,
+      const Payload &payload,
+      [[maybe_unused]] const size_t key_len)
+  {
+    if constexpr (IsVarLenKey<Key>()) {
+      return index_->Write(key, payload, key_len);
+    } else {
+      return index_->Write(key, payload);
+    }
+  }
+
+  auto
+  Insert(  //
+      const Key &key,
+      const Payload &payload,
+      [[maybe_unused]] const size_t key_len)
+  {
+    if constexpr (IsVarLenKey<Key>()) {
+      return index_->Insert(key, payload, key_len);
+    } else {
+      return index_->Insert(key, payload);
+    }
+  }
+
+  auto
+  Update(  //
+      const Key &key,
+      const Payload &payload,
+      [[maybe_unused]] const size_t key_len)
+  {
+    if constexpr (IsVarLenKey<Key>()) {
+      return index_->Update(key, payload, key_len);
+    } else {
+      return index_->Update(key, payload);
+    }
+  }
+
+  auto
+  Delete(  //
+      const Key &key,
+      [[maybe_unused]] const size_t key_len)
+  {
+    if constexpr (IsVarLenKey<Key>()) {
+      return index_->Delete(key, key_len);
+    } else {
+      return index_->Delete(key);
+    }
+  }
+
   /*############################################################################
    * Internal member variables
    *##########################################################################*/
 
   /// an actual target implementation
   std::unique_ptr<Index_t> index_{nullptr};
+
+  /// the number of point reads kept in flight by each worker.
+  size_t interleaved_read_num_{1};
 };
 
 }  // namespace dbgroup
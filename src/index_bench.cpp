@@ -14,15 +14,18 @@
  * limitations under the License.
  */
 
+// C++ standard libraries
+#include <limits>
+
 // external system libraries
 #include <gflags/gflags.h>
 
-// external sources
-#include "benchmark/benchmarker.hpp"
-
 // local sources
 #include "cla_validator.hpp"
+#include "closed_loop_benchmarker.hpp"
 #include "index.hpp"
+#include "open_loop_benchmarker.hpp"
+#include "timed_benchmarker.hpp"
 #include "workload/operation_engine.hpp"
 
 /*##############################################################################
@@ -36,14 +39,31 @@ DEFINE_string(seed, "", "A random seed to control reproducibility");
 DEFINE_string(workload,
               "workload/ycsb_a.json",
               "The path to a JSON file that contains a target workload");
+DEFINE_string(record_trace, "", "The path to a file to dump generated operations");
+DEFINE_string(replay_trace, "", "The path to a recorded trace file to be replayed");
+DEFINE_string(dataset, "", "The path to a SOSD-format file of sorted uint64 keys to be used");
 DEFINE_bool(csv, false, "Output benchmark results as CSV format");
+DEFINE_bool(csv_bytes, false, "Append throughput in bytes/s to CSV results of closed loops");
 DEFINE_bool(throughput, true, "true: measure throughput, false: measure latency");
+DEFINE_double(target_rate, 0, "Operations per second issued by all workers (0: closed loop)");
+DEFINE_string(arrival, "poisson", "The arrival process of an open loop (constant or poisson)");
+DEFINE_bool(var_len_keys, false, "Use variable-length keys (their lengths are given in a workload)");
+DEFINE_bool(materialize_keys, false, "Build fixed-length keys in advance of benchmarking");
+DEFINE_bool(stream_ops, false, "Generate operations during benchmarking to bound memory usage");
+DEFINE_uint64(interleaved_reads, 1, "The number of point reads kept in flight by each worker");
 
 DEFINE_validator(num_exec, &ValidateNonZero);
 DEFINE_validator(num_thread, &ValidateNonZero);
 DEFINE_validator(timeout, &ValidateNonZero);
 DEFINE_validator(seed, &ValidateRandomSeed);
 DEFINE_validator(workload, &ValidateWorkload);
+DEFINE_validator(replay_trace, &ValidateTraceFile);
+DEFINE_validator(dataset, &ValidateDatasetFile);
+DEFINE_validator(target_rate, &ValidateNonNegative);
+DEFINE_validator(arrival, &ValidateArrival);
+DEFINE_validator(var_len_keys, &ValidateVarLenKeys);
+DEFINE_validator(materialize_keys, &ValidateMaterializeKeys);
+DEFINE_validator(interleaved_reads, &ValidateInterleavedReads);
 
 #ifdef INDEX_BENCH_BUILD_LONG_KEYS
 DEFINE_uint64(key_size, 8, "The size of target keys (only 8, 16, 32, 64, and 128 can be used)");
@@ -52,13 +72,44 @@ DEFINE_validator(key_size, &ValidateKeySize);
 DEFINE_uint64(key_size, 8, "The size of target keys (only 8 can be used)");
 #endif
 
-/*##############################################################################
- * Utility functions
- *############################################################################*/
+#ifdef INDEX_BENCH_BUILD_LARGE_PAYLOADS
+DEFINE_uint64(payload_size,
+              8,
+              "The size of target payloads (only 8, 32, 128, 256, 1024, and 4096 can be used)");
+DEFINE_validator(payload_size, &ValidatePayloadSize);
+#else
+DEFINE_uint64(payload_size, 8, "The size of target payloads (only 8 can be used)");
+#endif
 
 namespace dbgroup
 {
 
+/*##############################################################################
+ * Type aliases
+ *############################################################################*/
+
+template <class K, class V>
+using BTreePMLVarLen_t = ::dbgroup::index::b_tree::BTreePMLVarLen<K, V, KeyComp_t<K>>;
+
+template <class K, class V>
+using BTreePSLVarLen_t = ::dbgroup::index::b_tree::BTreePSLVarLen<K, V, KeyComp_t<K>>;
+
+template <class K, class V>
+using BTreeOMLVarLen_t = ::dbgroup::index::b_tree::BTreeOMLVarLen<K, V, KeyComp_t<K>>;
+
+template <class K, class V>
+using BTreeOSLVarLen_t = ::dbgroup::index::b_tree::BTreeOSLVarLen<K, V, KeyComp_t<K>>;
+
+template <class K, class V>
+using BwTreeVarLen_t = ::dbgroup::index::bw_tree::BwTreeVarLen<K, V, KeyComp_t<K>>;
+
+template <class K, class V>
+using BzTree_t = ::dbgroup::index::bztree::BzTree<K, V, KeyComp_t<K>>;
+
+/*##############################################################################
+ * Utility functions
+ *############################################################################*/
+
 template <class Key, class Payload, class Index_t>
 auto
 Run(  //
@@ -66,9 +117,7 @@ Run(  //
     const bool force_use_bulkload = false)  //
     -> bool
 {
-  using Operation_t = Operation<Key, Payload>;
   using OperationEngine_t = OperationEngine<Key, Payload>;
-  using Bench_t = ::dbgroup::benchmark::Benchmarker<Index_t, Operation_t, OperationEngine_t>;
   using Json_t = ::nlohmann::json;
 
   // create an operation engine
@@ -77,34 +126,97 @@ Run(  //
   Json_t parsed_json{};
   workload_in >> parsed_json;
   ops_engine.ParseJson(parsed_json);
+  if (!FLAGS_record_trace.empty()) {
+    ops_engine.RecordTrace(FLAGS_record_trace);
+  }
+  if (!FLAGS_replay_trace.empty()) {
+    ops_engine.ReplayTrace(FLAGS_replay_trace);
+  }
+  if (FLAGS_stream_ops) {
+    ops_engine.StreamOperations();
+  }
 
   // prepare random seed if needed
   auto random_seed = (FLAGS_seed.empty()) ? std::random_device{}() : std::stoul(FLAGS_seed);
 
   // create a target index
   auto [init_size, use_all_thread, use_bulkload] = ops_engine.GetInitParameters();
+  if (const auto *dataset = KeyDataset::Get(); dataset) {
+    if (init_size > dataset->GetKeyNum()) {
+      throw std::runtime_error{"ERROR: the initial keys exceed the ones in the dataset."};
+    }
+
+    // each operation appends at most one key in the latest access pattern
+    const auto append_num = (ops_engine.IsDurationBased())
+                                ? std::numeric_limits<size_t>::max()
+                                : FLAGS_num_exec * FLAGS_num_thread;
+    dataset->CheckMaxKeyID(ops_engine.GetMaxKeyID(append_num));
+  }
   if (force_use_bulkload) {
     use_bulkload = true;
   }
   const auto init_thread = (use_all_thread) ? kMaxCoreNum : 1;
+  if constexpr (!std::is_integral_v<Key>) {
+    if (KeyDataset::Get() != nullptr) {
+      throw std::runtime_error{"ERROR: a dataset can only be used with integer keys."};
+    }
+  }
+  if constexpr (IsVarLenKey<Key>()) {
+    KeyArena::Build(ops_engine.GetMaxKeyNum(), ops_engine.GetKeyLengthDistribution(), init_thread);
+  } else if constexpr (std::is_class_v<Key>) {
+    if (FLAGS_materialize_keys) {
+      FixedLenKeyArena<Key>::Build(ops_engine.GetMaxKeyNum(), init_thread, BuildKey<Key>);
+    }
+  }
   const auto &entries = PrepareBulkLoadEntries<Key, Payload>(init_size, init_thread);
   Index_t index{};
   index.Construct(entries, init_thread, use_bulkload);
+  if (!index.SetInterleavedReadNum(FLAGS_interleaved_reads) && !FLAGS_csv) {
+    std::cout << "NOTE: " << target_name << " executes point reads one by one." << std::endl;
+  }
+
+  if constexpr (std::is_class_v<Payload>) {
+    GetPayloads<Payload>();  // build payloads outside measured regions
+  }
 
   // run benchmark
-  Bench_t bench{index,       target_name,      ops_engine, FLAGS_num_exec, FLAGS_num_thread,
-                random_seed, FLAGS_throughput, FLAGS_csv,  FLAGS_timeout};
+  const auto record_size = GetRecordSize<Key, Payload>();
+  if (ops_engine.IsDurationBased()) {
+    if (!FLAGS_throughput) {
+      throw std::runtime_error{"ERROR: duration-based phases only support throughput."};
+    }
+    if (FLAGS_target_rate > 0) {
+      throw std::runtime_error{"ERROR: duration-based phases do not support an open loop."};
+    }
+    TimedBenchmarker<Index_t, OperationEngine_t> bench{
+        index, target_name, ops_engine, FLAGS_num_thread, random_seed, record_size, FLAGS_csv};
+    bench.Run();
+    return true;
+  }
+  if (FLAGS_target_rate > 0) {
+    const auto use_poisson = FLAGS_arrival == "poisson";
+    OpenLoopBenchmarker<Index_t, OperationEngine_t> bench{
+        index,       target_name,       ops_engine,  FLAGS_num_exec, FLAGS_num_thread,
+        random_seed, FLAGS_target_rate, use_poisson, record_size,    FLAGS_csv,
+        FLAGS_timeout};
+    bench.Run();
+    return true;
+  }
+  ClosedLoopBenchmarker<Index_t, OperationEngine_t> bench{
+      index,       target_name,      ops_engine,  FLAGS_num_exec, FLAGS_num_thread,
+      random_seed, FLAGS_throughput, record_size, FLAGS_csv,      FLAGS_csv_bytes,
+      FLAGS_timeout};
   bench.Run();
 
   return true;
 }
 
-template <class K>
+template <class K, class V>
 void
 RunWithMultipleIndexes()
 {
   // run benchmark for each implementaton
-  using V = uint64_t;
+  using V_FOR_APPEND = std::conditional_t<std::is_same_v<V, uint64_t>, int64_t, V>;
   auto run_any = false;  // check any indexes are specified as benchmarking targets
 
   if (!FLAGS_csv) {
@@ -116,44 +228,43 @@ RunWithMultipleIndexes()
    *--------------------------------------------------------------------------*/
 
   if (FLAGS_b_pml) {
-    using BTreePML_t = Index<K, V, ::dbgroup::index::b_tree::BTreePMLVarLen>;
+    using BTreePML_t = Index<K, V, BTreePMLVarLen_t>;
     Run<K, V, BTreePML_t>("B+tree based on PML", kUseBulkload);
     run_any = true;
   }
 
   if (FLAGS_b_psl) {
-    using BTreePSL_t = Index<K, V, ::dbgroup::index::b_tree::BTreePSLVarLen>;
+    using BTreePSL_t = Index<K, V, BTreePSLVarLen_t>;
     Run<K, V, BTreePSL_t>("B+tree based on PSL", kUseBulkload);
     run_any = true;
   }
 
   if (FLAGS_b_oml) {
-    using BTreeOML_t = Index<K, V, ::dbgroup::index::b_tree::BTreeOMLVarLen>;
+    using BTreeOML_t = Index<K, V, BTreeOMLVarLen_t>;
     Run<K, V, BTreeOML_t>("B+tree based on OML");
     run_any = true;
   }
 
   if (FLAGS_b_osl) {
-    using BTreeOSL_t = Index<K, V, ::dbgroup::index::b_tree::BTreeOSLVarLen>;
+    using BTreeOSL_t = Index<K, V, BTreeOSLVarLen_t>;
     Run<K, V, BTreeOSL_t>("B+tree based on OSL");
     run_any = true;
   }
 
   if (FLAGS_bw) {
-    using BwTree_t = Index<K, V, ::dbgroup::index::bw_tree::BwTreeVarLen>;
+    using BwTree_t = Index<K, V, BwTreeVarLen_t>;
     Run<K, V, BwTree_t>("Bw-tree");
     run_any = true;
   }
 
   if (FLAGS_bz) {
-    using BzInPlace_t = Index<K, V, ::dbgroup::index::bztree::BzTree>;
+    using BzInPlace_t = Index<K, V, BzTree_t>;
     Run<K, V, BzInPlace_t>("BzTree in-place mode");
     run_any = true;
   }
 
   if (FLAGS_bz_append) {
-    using V_FOR_APPEND = int64_t;
-    using BzAppend_t = Index<K, V_FOR_APPEND, ::dbgroup::index::bztree::BzTree>;
+    using BzAppend_t = Index<K, V_FOR_APPEND, BzTree_t>;
     Run<K, V_FOR_APPEND, BzAppend_t>("BzTree append mode");
     run_any = true;
   }
@@ -163,34 +274,40 @@ RunWithMultipleIndexes()
    *--------------------------------------------------------------------------*/
 
 #ifdef INDEX_BENCH_BUILD_OPTIMIZED_B_TREES
-  if (FLAGS_b_pml_opt) {
-    using BTreePMLOpt_t = Index<K, V, ::dbgroup::index::b_tree::BTreePMLFixLen>;
-    Run<K, V, BTreePMLOpt_t>("Optimized B+tree based on PML", kUseBulkload);
-    run_any = true;
-  }
+  if constexpr (IsVarLenKey<K>()) {
+    if (FLAGS_b_pml_opt || FLAGS_b_psl_opt || FLAGS_b_oml_opt || FLAGS_b_osl_opt || FLAGS_bw_opt) {
+      std::cout << "NOTE: the optimized indexes do not support variable-length keys." << std::endl;
+    }
+  } else {
+    if (FLAGS_b_pml_opt) {
+      using BTreePMLOpt_t = Index<K, V, ::dbgroup::index::b_tree::BTreePMLFixLen>;
+      Run<K, V, BTreePMLOpt_t>("Optimized B+tree based on PML", kUseBulkload);
+      run_any = true;
+    }
 
-  if (FLAGS_b_psl_opt) {
-    using BTreePSLOpt_t = Index<K, V, ::dbgroup::index::b_tree::BTreePSLFixLen>;
-    Run<K, V, BTreePSLOpt_t>("Optimized B+tree based on PSL", kUseBulkload);
-    run_any = true;
-  }
+    if (FLAGS_b_psl_opt) {
+      using BTreePSLOpt_t = Index<K, V, ::dbgroup::index::b_tree::BTreePSLFixLen>;
+      Run<K, V, BTreePSLOpt_t>("Optimized B+tree based on PSL", kUseBulkload);
+      run_any = true;
+    }
 
-  if (FLAGS_b_oml_opt) {
-    using BTreeOMLOpt_t = Index<K, V, ::dbgroup::index::b_tree::BTreeOMLFixLen>;
-    Run<K, V, BTreeOMLOpt_t>("Optimized B+tree based on OML");
-    run_any = true;
-  }
+    if (FLAGS_b_oml_opt) {
+      using BTreeOMLOpt_t = Index<K, V, ::dbgroup::index::b_tree::BTreeOMLFixLen>;
+      Run<K, V, BTreeOMLOpt_t>("Optimized B+tree based on OML");
+      run_any = true;
+    }
 
-  if (FLAGS_b_osl_opt) {
-    using BTreeOSLOpt_t = Index<K, V, ::dbgroup::index::b_tree::BTreeOSLFixLen>;
-    Run<K, V, BTreeOSLOpt_t>("Optimized B+tree based on OSL");
-    run_any = true;
-  }
+    if (FLAGS_b_osl_opt) {
+      using BTreeOSLOpt_t = Index<K, V, ::dbgroup::index::b_tree::BTreeOSLFixLen>;
+      Run<K, V, BTreeOSLOpt_t>("Optimized B+tree based on OSL");
+      run_any = true;
+    }
 
-  if (FLAGS_bw_opt) {
-    using BwTreeOpt_t = Index<K, V, ::dbgroup::index::bw_tree::BwTreeFixLen>;
-    Run<K, V, BwTreeOpt_t>("Optimized Bw-tree");
-    run_any = true;
+    if (FLAGS_bw_opt) {
+      using BwTreeOpt_t = Index<K, V, ::dbgroup::index::bw_tree::BwTreeFixLen>;
+      Run<K, V, BwTreeOpt_t>("Optimized Bw-tree");
+      run_any = true;
+    }
   }
 #endif
 
@@ -207,8 +324,11 @@ RunWithMultipleIndexes()
 #endif
 
 #ifdef INDEX_BENCH_BUILD_SKIP_LIST
-  if (FLAGS_skip_list) {
-    using V_FOR_APPEND = int64_t;
+  if constexpr (IsVarLenKey<K>()) {
+    if (FLAGS_skip_list) {
+      std::cout << "NOTE: the skip list does not support variable-length keys." << std::endl;
+    }
+  } else if (FLAGS_skip_list) {
     using SkipList_t = Index<K, V_FOR_APPEND, ::dbgroup::index::skip_list::SkipList>;
     Run<K, V_FOR_APPEND, SkipList_t>("Skip list");
     run_any = true;
@@ -276,34 +396,72 @@ RunWithMultipleIndexes()
   }
 }
 
+template <class K>
+void
+RunWithSelectedPayload()
+{
+#if defined(INDEX_BENCH_BUILD_LARGE_PAYLOADS) && !defined(INDEX_BENCH_COMPARE_WITH_SOTA)
+  switch (FLAGS_payload_size) {
+    case kPayload8:
+      RunWithMultipleIndexes<K, uint64_t>();
+      break;
+    case kPayload32:
+      RunWithMultipleIndexes<K, VarLenData<kPayload32>>();
+      break;
+    case kPayload128:
+      RunWithMultipleIndexes<K, VarLenData<kPayload128>>();
+      break;
+    case kPayload256:
+      RunWithMultipleIndexes<K, VarLenData<kPayload256>>();
+      break;
+    case kPayload1K:
+      RunWithMultipleIndexes<K, VarLenData<kPayload1K>>();
+      break;
+    case kPayload4K:
+      RunWithMultipleIndexes<K, VarLenData<kPayload4K>>();
+      break;
+    default:
+      break;
+  }
+#else
+  RunWithMultipleIndexes<K, uint64_t>();
+#endif
+}
+
 void
 RunWithSelectedKey()
 {
   if constexpr (kUseIntegerKeys) {
-    RunWithMultipleIndexes<uint64_t>();
+    RunWithMultipleIndexes<uint64_t, uint64_t>();
   } else {
+#ifndef INDEX_BENCH_COMPARE_WITH_SOTA
+    if (FLAGS_var_len_keys) {
+      RunWithSelectedPayload<char *>();
+      return;
+    }
+#endif
 #ifdef INDEX_BENCH_BUILD_LONG_KEYS
     switch (FLAGS_key_size) {
       case k8:
-        RunWithMultipleIndexes<VarLenData<k8>>();
+        RunWithSelectedPayload<VarLenData<k8>>();
         break;
       case k16:
-        RunWithMultipleIndexes<VarLenData<k16>>();
+        RunWithSelectedPayload<VarLenData<k16>>();
         break;
       case k32:
-        RunWithMultipleIndexes<VarLenData<k32>>();
+        RunWithSelectedPayload<VarLenData<k32>>();
         break;
       case k64:
-        RunWithMultipleIndexes<VarLenData<k64>>();
+        RunWithSelectedPayload<VarLenData<k64>>();
         break;
       case k128:
-        RunWithMultipleIndexes<VarLenData<k128>>();
+        RunWithSelectedPayload<VarLenData<k128>>();
         break;
       default:
         break;
     }
 #else
-    RunWithMultipleIndexes<VarLenData<k8>>();
+    RunWithSelectedPayload<VarLenData<k8>>();
 #endif
   }
 }
@@ -321,6 +479,9 @@ main(int argc, char *argv[])  //
   // parse command line options
   gflags::SetUsageMessage("measures throughput/latency for thread-safe index implementations.");
   gflags::ParseCommandLineFlags(&argc, &argv, false);
+  if (!FLAGS_dataset.empty()) {
+    dbgroup::KeyDataset::Load(FLAGS_dataset);
+  }
 
   dbgroup::RunWithSelectedKey();
 
@@ -253,6 +253,14 @@ class AlexOLCWrapper
   Index_t index_{};
 };
 
+template <>
+constexpr auto
+HasEndKeyScan<AlexOLCWrapper>()  //
+    -> bool
+{
+  return false;
+}
+
 }  // namespace dbgroup
 
 #endif  // INDEX_BENCHMARK_INDEXES_ALEX_OLC_WRAPPER_HPP
@@ -272,6 +272,14 @@ class ArtOLCWrapper
   Index_t index_{LoadKey};
 };
 
+template <>
+constexpr auto
+HasEndKeyScan<ArtOLCWrapper>()  //
+    -> bool
+{
+  return false;
+}
+
 }  // namespace dbgroup
 
 #endif  // INDEX_BENCHMARK_INDEXES_ART_OLC_WRAPPER_HPP
@@ -18,6 +18,10 @@
 #define INDEX_BENCHMARK_INDEXES_B_TREE_OLC_WRAPPER_HPP
 
 // C++ standard libraries
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <utility>
 
@@ -26,6 +30,7 @@
 
 // local sources
 #include "common.hpp"
+#include "indexes/optimistic_leaf_scan.hpp"
 
 namespace dbgroup
 {
@@ -38,6 +43,9 @@ class BTreeOLCWrapper
    *##########################################################################*/
 
   using Index_t = btreeolc::BTree<Key, Payload>;
+  using Node_t = btreeolc::NodeBase;
+  using Inner_t = btreeolc::BTreeInner<Key>;
+  using Leaf_t = btreeolc::BTreeLeaf<Key, Payload>;
   using ScanKey = std::optional<std::tuple<const Key &, size_t, bool>>;
 
  public:
@@ -60,13 +68,14 @@ class BTreeOLCWrapper
      * @brief Construct a new object as an initial iterator.
      *
      * @param index a pointer to an index.
+     * @param records the scanned records.
+     * @param size the number of scanned records.
      */
     RecordIterator(  //
-        Index_t *index,
-        Key begin_key,
-        Payload *payloads,
+        BTreeOLCWrapper *index,
+        std::pair<Key, Payload> *records,
         size_t size)
-        : index_{index}, key_{std::move(begin_key)}, payloads_{payloads}, size_{size}
+        : index_{index}, records_{records}, size_{size}
     {
     }
 
@@ -98,11 +107,13 @@ class BTreeOLCWrapper
     operator bool()
     {
       while (true) {
-        if (pos_ < size_) return true;        // records remain in this node
-        if (size_ < kScanSize) return false;  // this node is the end of range-scan
+        if (pos_ < size_) return true;  // records remain in this node
+        if (size_ == 0) return false;   // no record follows the scanned ones
 
-        key_ = key_ + kScanSize;
-        size_ = index_->scan(key_, kScanSize, payloads_);
+        // resume from the next key of the last returned one
+        const auto last_key = records_[size_ - 1].first;
+        if (last_key == std::numeric_limits<Key>::max()) return false;
+        size_ = index_->ScanLeaf(last_key + 1, records_);
         pos_ = 0;
       }
     }
@@ -128,7 +139,7 @@ class BTreeOLCWrapper
     GetPayload() const  //
         -> Payload
     {
-      return payloads_[pos_];
+      return records_[pos_].second;
     }
 
    private:
@@ -136,16 +147,13 @@ class BTreeOLCWrapper
      * Internal member variables
      *########################################################################*/
 
-    /// a pointer to a BwTree for sibling scanning.
-    Index_t *index_{nullptr};
+    /// a pointer to an index for sibling scanning.
+    BTreeOLCWrapper *index_{nullptr};
 
-    /// the current begin key.
-    Key key_{};
+    /// the scanned records.
+    std::pair<Key, Payload> *records_{nullptr};
 
-    /// the scanned payloads.
-    Payload *payloads_{nullptr};
-
-    /// the number of payloads.
+    /// the number of records.
     size_t size_{0};
 
     /// the position of a current record.
@@ -186,15 +194,74 @@ class BTreeOLCWrapper
     return std::nullopt;
   }
 
+  /**
+   * @brief Read the payloads of given keys with interleaving their traversals.
+   *
+   * This function keeps `in_flight` traversals at the same time in the manner of
+   * asynchronous memory access chaining (AMAC): each traversal prefetches its
+   * next node and then yields to another one, so the cache misses of different
+   * traversals are overlapped. Each step follows the protocol of `lookup`, and
+   * a traversal restarts from the root if any version check fails.
+   *
+   * @param keys the head of target keys.
+   * @param n the number of target keys.
+   * @param results the head of a buffer for read payloads.
+   * @param in_flight the number of traversals in flight.
+   */
+  void
+  ReadInterleaved(  //
+      const Key *keys,
+      const size_t n,
+      std::optional<Payload> *results,
+      const size_t in_flight)
+  {
+    std::array<ReadState, kMaxInterleavedReadNum> states{};
+    size_t next = 0;
+    size_t active = 0;
+    for (; active < in_flight && active < kMaxInterleavedReadNum && next < n; ++active) {
+      StartRead(states[active], next++);
+    }
+
+    while (active > 0) {
+      for (size_t i = 0; i < active;) {
+        auto &state = states[i];
+        if (!StepRead(state, keys[state.pos], results[state.pos])) {
+          ++i;
+        } else if (next < n) {
+          StartRead(state, next++);
+          ++i;
+        } else {
+          state = states[--active];  // the last traversal takes over this slot
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Read the payloads of a batch of keys.
+   *
+   * @param keys the head of target keys.
+   * @param n the number of target keys.
+   * @param results the head of a buffer for read payloads.
+   */
+  void
+  MultiRead(  //
+      const Key *keys,
+      const size_t n,
+      std::optional<Payload> *results)
+  {
+    ReadInterleaved(keys, n, results, kMultiReadInFlight);
+  }
+
   auto
   Scan(const ScanKey &begin_key = std::nullopt)  //
       -> RecordIterator
   {
-    thread_local Payload payloads[kScanSize];
+    thread_local std::pair<Key, Payload> records[kScanSize];
 
     auto &&key = (begin_key) ? std::get<0>(*begin_key) : Key{0};
-    const auto size = index_.scan(key, kScanSize, payloads);
-    return RecordIterator{&index_, key, payloads, size};
+    const auto size = ScanLeaf(key, records);
+    return RecordIterator{this, records, size};
   }
 
   auto
@@ -232,6 +299,133 @@ class BTreeOLCWrapper
   }
 
  private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// the number of traversals in flight for multi reads.
+  static constexpr size_t kMultiReadInFlight = 8;
+
+  /*############################################################################
+   * Internal classes
+   *##########################################################################*/
+
+  /**
+   * @brief The state of a suspended traversal for interleaved reads.
+   *
+   */
+  struct ReadState {
+    /// the position of a target key.
+    size_t pos{0};
+
+    /// the node to be visited next (it has been prefetched).
+    Node_t *node{nullptr};
+
+    /// the parent of the next node.
+    Inner_t *parent{nullptr};
+
+    /// the version of the parent when the next node was read.
+    uint64_t parent_ver{0};
+  };
+
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Start (or restart) a traversal from the root.
+   *
+   */
+  void
+  StartRead(  //
+      ReadState &state,
+      const size_t pos)
+  {
+    state.pos = pos;
+    state.node = index_.root;
+    state.parent = nullptr;
+    __builtin_prefetch(state.node);
+  }
+
+  /**
+   * @brief Visit the next node of a traversal.
+   *
+   * @retval true if the traversal has finished.
+   * @retval false if the traversal has been suspended or restarted.
+   */
+  auto
+  StepRead(  //
+      ReadState &state,
+      const Key &key,
+      std::optional<Payload> &result)  //
+      -> bool
+  {
+    auto restart = false;
+    auto *node = state.node;
+    const auto ver = node->readLockOrRestart(restart);
+    if (restart || (state.parent == nullptr && node != index_.root)) {
+      StartRead(state, state.pos);
+      return false;
+    }
+    if (state.parent != nullptr) {
+      state.parent->readUnlockOrRestart(state.parent_ver, restart);
+      if (restart) {
+        StartRead(state, state.pos);
+        return false;
+      }
+    }
+
+    if (node->type == btreeolc::PageType::BTreeInner) {
+      auto *inner = static_cast<Inner_t *>(node);
+      auto *child = inner->children[inner->lowerBound(key)];
+      inner->checkOrRestart(ver, restart);
+      if (restart) {
+        StartRead(state, state.pos);
+        return false;
+      }
+
+      state.node = child;
+      state.parent = inner;
+      state.parent_ver = ver;
+      __builtin_prefetch(child);
+      return false;
+    }
+
+    auto *leaf = static_cast<Leaf_t *>(node);
+    const auto pos = leaf->lowerBound(key);
+    std::optional<Payload> payload{};
+    if (pos < leaf->count && leaf->keys[pos] == key) {
+      payload = leaf->payloads[pos];
+    }
+    node->readUnlockOrRestart(ver, restart);
+    if (restart) {
+      StartRead(state, state.pos);
+      return false;
+    }
+
+    result = payload;
+    return true;
+  }
+
+  /**
+   * @brief Copy the records in a leaf node that follow a given key.
+   *
+   * The native scan of BTreeOLC only returns payloads, so this function copies
+   * keys as well to continue scanning from the last returned key.
+   *
+   * @param key a begin key (inclusive).
+   * @param records the head of a buffer for scanned records.
+   * @return the number of scanned records.
+   */
+  auto
+  ScanLeaf(  //
+      const Key &key,
+      std::pair<Key, Payload> *records)  //
+      -> size_t
+  {
+    return ScanLeafOptimistically<Node_t, Inner_t, Leaf_t>(index_, key, records, kScanSize);
+  }
+
   /*############################################################################
    * Internal member variables
    *##########################################################################*/
@@ -239,6 +433,30 @@ class BTreeOLCWrapper
   Index_t index_{};
 };
 
+template <>
+constexpr auto
+HasEndKeyScan<BTreeOLCWrapper>()  //
+    -> bool
+{
+  return false;
+}
+
+template <>
+constexpr auto
+HasMultiRead<BTreeOLCWrapper>()  //
+    -> bool
+{
+  return true;
+}
+
+template <>
+constexpr auto
+HasInterleavedRead<BTreeOLCWrapper>()  //
+    -> bool
+{
+  return true;
+}
+
 }  // namespace dbgroup
 
 #endif  // INDEX_BENCHMARK_INDEXES_B_TREE_OLC_WRAPPER_HPP
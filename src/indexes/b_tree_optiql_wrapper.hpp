@@ -18,6 +18,9 @@
 #define INDEX_BENCHMARK_INDEXES_B_TREE_OPTIQL_WRAPPER_HPP
 
 // C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <utility>
 
@@ -26,6 +29,7 @@
 
 // local sources
 #include "common.hpp"
+#include "indexes/optimistic_leaf_scan.hpp"
 
 namespace dbgroup
 {
@@ -38,6 +42,9 @@ class BTreeOptiQLWrapper
    *##########################################################################*/
 
   using Index_t = btreeolc::BTreeOMCS<Key, Payload>;
+  using Node_t = btreeolc::NodeBase;
+  using Inner_t = btreeolc::BTreeInner<Key>;
+  using Leaf_t = btreeolc::BTreeLeaf<Key, Payload>;
   using ScanKey = std::optional<std::tuple<const Key &, size_t, bool>>;
 
  public:
@@ -60,13 +67,14 @@ class BTreeOptiQLWrapper
      * @brief Construct a new object as an initial iterator.
      *
      * @param index a pointer to an index.
+     * @param records the scanned records.
+     * @param size the number of scanned records.
      */
     RecordIterator(  //
-        Index_t *index,
-        Key begin_key,
-        Payload *payloads,
+        BTreeOptiQLWrapper *index,
+        std::pair<Key, Payload> *records,
         size_t size)
-        : index_{index}, key_{std::move(begin_key)}, payloads_{payloads}, size_{size}
+        : index_{index}, records_{records}, size_{size}
     {
     }
 
@@ -98,11 +106,13 @@ class BTreeOptiQLWrapper
     operator bool()
     {
       while (true) {
-        if (pos_ < size_) return true;        // records remain in this node
-        if (size_ < kScanSize) return false;  // this node is the end of range-scan
+        if (pos_ < size_) return true;  // records remain in this node
+        if (size_ == 0) return false;   // no record follows the scanned ones
 
-        key_ = key_ + kScanSize;
-        size_ = index_->scan(key_, kScanSize, payloads_);
+        // resume from the next key of the last returned one
+        const auto last_key = records_[size_ - 1].first;
+        if (last_key == std::numeric_limits<Key>::max()) return false;
+        size_ = index_->ScanLeaf(last_key + 1, records_);
         pos_ = 0;
       }
     }
@@ -128,7 +138,7 @@ class BTreeOptiQLWrapper
     GetPayload() const  //
         -> Payload
     {
-      return payloads_[pos_];
+      return records_[pos_].second;
     }
 
    private:
@@ -136,16 +146,13 @@ class BTreeOptiQLWrapper
      * Internal member variables
      *########################################################################*/
 
-    /// a pointer to a BwTree for sibling scanning.
-    Index_t *index_{nullptr};
+    /// a pointer to an index for sibling scanning.
+    BTreeOptiQLWrapper *index_{nullptr};
 
-    /// the current begin key.
-    Key key_{};
+    /// the scanned records.
+    std::pair<Key, Payload> *records_{nullptr};
 
-    /// the scanned payloads.
-    Payload *payloads_{nullptr};
-
-    /// the number of payloads.
+    /// the number of records.
     size_t size_{0};
 
     /// the position of a current record.
@@ -190,11 +197,11 @@ class BTreeOptiQLWrapper
   Scan(const ScanKey &begin_key = std::nullopt)  //
       -> RecordIterator
   {
-    thread_local Payload payloads[kScanSize];
+    thread_local std::pair<Key, Payload> records[kScanSize];
 
     auto &&key = (begin_key) ? std::get<0>(*begin_key) : Key{0};
-    const auto size = index_.scan(key, kScanSize, payloads);
-    return RecordIterator{&index_, key, payloads, size};
+    const auto size = ScanLeaf(key, records);
+    return RecordIterator{this, records, size};
   }
 
   auto
@@ -232,6 +239,30 @@ class BTreeOptiQLWrapper
   }
 
  private:
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Copy the records in a leaf node that follow a given key.
+   *
+   * OptiQL shares the node layout of BTreeOLC, and its native scan also returns
+   * only payloads. Thus, this function copies keys as well to continue scanning
+   * from the last returned key.
+   *
+   * @param key a begin key (inclusive).
+   * @param records the head of a buffer for scanned records.
+   * @return the number of scanned records.
+   */
+  auto
+  ScanLeaf(  //
+      const Key &key,
+      std::pair<Key, Payload> *records)  //
+      -> size_t
+  {
+    return ScanLeafOptimistically<Node_t, Inner_t, Leaf_t>(index_, key, records, kScanSize);
+  }
+
   /*############################################################################
    * Internal member variables
    *##########################################################################*/
@@ -239,6 +270,14 @@ class BTreeOptiQLWrapper
   Index_t index_{};
 };
 
+template <>
+constexpr auto
+HasEndKeyScan<BTreeOptiQLWrapper>()  //
+    -> bool
+{
+  return false;
+}
+
 }  // namespace dbgroup
 
 #endif  // INDEX_BENCHMARK_INDEXES_B_TREE_OPTIQL_WRAPPER_HPP
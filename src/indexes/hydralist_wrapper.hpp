@@ -61,15 +61,9 @@ class HydraListWrapper
     /**
      * @brief Construct a new object as an initial iterator.
      *
-     * @param index a pointer to an index.
+     * @param payloads the scanned payloads.
      */
-    RecordIterator(  //
-        Index_t *index,
-        Key &&key,
-        std::vector<Payload> &payloads)
-        : index_{index}, key_{key}, payloads_{payloads}
-    {
-    }
+    explicit RecordIterator(std::vector<Payload> &payloads) : payloads_{payloads} {}
 
     RecordIterator(const RecordIterator &) = delete;
     RecordIterator(RecordIterator &&) = delete;
@@ -98,16 +92,8 @@ class HydraListWrapper
     explicit
     operator bool()
     {
-      while (true) {
-        const auto size = payloads_.size();
-        if (pos_ < size) return true;        // records remain in this node
-        if (size < kScanSize) return false;  // this node is the end of range-scan
-
-        key_ += kScanSize;
-        payloads_.clear();
-        index_->scan(key_, kScanSize, payloads_);
-        pos_ = 0;
-      }
+      // the native scan cannot be continued, so longer scans are rejected in advance
+      return pos_ < payloads_.size();
     }
 
     /**
@@ -139,12 +125,6 @@ class HydraListWrapper
      * Internal member variables
      *########################################################################*/
 
-    /// a pointer to a BwTree for sibling scanning.
-    Index_t *index_{nullptr};
-
-    /// the current begin key.
-    Key key_{};
-
     /// the scanned payloads.
     std::vector<Payload> &payloads_;
 
@@ -203,10 +183,10 @@ class HydraListWrapper
     thread_local std::vector<Payload> payloads{};
     payloads.clear();
 
-    auto key = (begin_key) ? std::get<0>(*begin_key) : Key{0};
+    const auto key = (begin_key) ? std::get<0>(*begin_key) : Key{0};
     index_.scan(key, kScanSize, payloads);
 
-    return RecordIterator{&index_, std::move(key), payloads};
+    return RecordIterator{payloads};
   }
 
   auto
@@ -256,6 +236,22 @@ HasSetUpTearDown<HydraListWrapper>()  //
   return true;
 }
 
+template <>
+constexpr auto
+HasEndKeyScan<HydraListWrapper>()  //
+    -> bool
+{
+  return false;
+}
+
+template <>
+constexpr auto
+GetMaxScanLength<HydraListWrapper>()  //
+    -> size_t
+{
+  return kScanSize;
+}
+
 }  // namespace dbgroup
 
 #endif  // INDEX_BENCHMARK_INDEXES_HYDRALIST_WRAPPER_HPP
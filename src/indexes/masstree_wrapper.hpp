@@ -105,12 +105,14 @@ class MasstreeWrapper
      * @brief Construct a new object as an initial iterator.
      *
      * @param index a pointer to an index.
+     * @param reverse a flag for scanning records in descending order.
      */
     RecordIterator(  //
         Table_t *table,
         Key &&key,
-        std::vector<Payload> &payloads)
-        : table_{table}, payloads_{payloads}, key_{key}
+        std::vector<Payload> &payloads,
+        const bool reverse = false)
+        : table_{table}, payloads_{payloads}, key_{key}, reverse_{reverse}
     {
     }
 
@@ -146,9 +148,13 @@ class MasstreeWrapper
         if (pos_ < size) return true;        // records remain in this node
         if (size < kScanSize) return false;  // this node is the end of range-scan
 
-        key_ = key_ + kScanSize;
-        Scanner scanner{kScanSize, payloads_};
-        table_->table().scan(ToStr(key_), true, scanner, *thread_info_);
+        // resume from the last returned key without including it
+        Scanner scanner{kScanSize, payloads_, key_};
+        if (reverse_) {
+          table_->table().rscan(ToStr(key_), false, scanner, *thread_info_);
+        } else {
+          table_->table().scan(ToStr(key_), false, scanner, *thread_info_);
+        }
         pos_ = 0;
       }
     }
@@ -190,8 +196,11 @@ class MasstreeWrapper
     /// the position of a current record.
     size_t pos_{0};
 
-    /// the current scan key.
+    /// the last key returned by Masstree.
     Key key_{};
+
+    /// a flag for scanning records in descending order.
+    bool reverse_{false};
   };
 
   class Scanner
@@ -203,8 +212,9 @@ class MasstreeWrapper
 
     Scanner(  //
         const size_t scan_size,
-        std::vector<Payload> &payloads)
-        : num_remain_(scan_size), payloads_(payloads)
+        std::vector<Payload> &payloads,
+        Key &last_key)
+        : num_remain_(scan_size), payloads_(payloads), last_key_(last_key)
     {
       payloads.clear();
     }
@@ -222,7 +232,7 @@ class MasstreeWrapper
 
     auto
     visit_value(  //
-        Str_t,
+        Str_t key,
         row_type *value,
         threadinfo &)  //
         -> bool
@@ -232,6 +242,7 @@ class MasstreeWrapper
       Payload payload{};
       memcpy(&payload, value->col(0).data(), sizeof(Payload));
       payloads_.emplace_back(std::move(payload));
+      last_key_ = FromStr(key);
 
       return (--num_remain_) > 0;
     }
@@ -244,6 +255,9 @@ class MasstreeWrapper
     int64_t num_remain_{0};
 
     std::vector<Payload> &payloads_;
+
+    /// the key of the last visited record.
+    Key &last_key_;
   };
 
   /*############################################################################
@@ -307,12 +321,25 @@ class MasstreeWrapper
     thread_local std::vector<Payload> payloads{kScanSize};
 
     auto key = (begin_key) ? std::get<0>(*begin_key) : Key{0};
-    Scanner scanner{kScanSize, payloads};
+    Scanner scanner{kScanSize, payloads, key};
     table_.table().scan(ToStr(key), true, scanner, *thread_info_);
 
     return RecordIterator{&table_, std::move(key), payloads};
   }
 
+  auto
+  ReverseScan(const ScanKey &begin_key = std::nullopt)  //
+      -> RecordIterator
+  {
+    thread_local std::vector<Payload> payloads{kScanSize};
+
+    auto key = (begin_key) ? std::get<0>(*begin_key) : ~Key{0};
+    Scanner scanner{kScanSize, payloads, key};
+    table_.table().rscan(ToStr(key), true, scanner, *thread_info_);
+
+    return RecordIterator{&table_, std::move(key), payloads, true};
+  }
+
   auto
   Write(  //
       const Key &key,
@@ -360,6 +387,15 @@ class MasstreeWrapper
     return Str_t{reinterpret_cast<const char *>(&swapped), sizeof(uint64_t)};
   }
 
+  static auto
+  FromStr(const Str_t &str)  //
+      -> uint64_t
+  {
+    uint64_t swapped{};
+    memcpy(&swapped, str.data(), sizeof(uint64_t));
+    return bswap_64(swapped);
+  }
+
   /*############################################################################
    * Internal member variables
    *##########################################################################*/
@@ -386,6 +422,22 @@ HasSetUpTearDown<MasstreeWrapper>()  //
   return true;
 }
 
+template <>
+constexpr auto
+HasEndKeyScan<MasstreeWrapper>()  //
+    -> bool
+{
+  return false;
+}
+
+template <>
+constexpr auto
+HasReverseScan<MasstreeWrapper>()  //
+    -> bool
+{
+  return true;
+}
+
 }  // namespace dbgroup
 
 #endif  // INDEX_BENCHMARK_INDEXES_MASSTREE_WRAPPER_HPP
@@ -258,6 +258,14 @@ HasSetUpTearDown<OpenBwTreeWrapper>()  //
   return true;
 }
 
+template <>
+constexpr auto
+HasEndKeyScan<OpenBwTreeWrapper>()  //
+    -> bool
+{
+  return false;
+}
+
 }  // namespace dbgroup
 
 #endif  // INDEX_BENCHMARK_INDEXES_OPEN_BW_TREE_HPP
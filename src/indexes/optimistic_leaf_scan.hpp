@@ -0,0 +1,99 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_INDEXES_OPTIMISTIC_LEAF_SCAN_HPP
+#define INDEX_BENCHMARK_INDEXES_OPTIMISTIC_LEAF_SCAN_HPP
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace dbgroup
+{
+
+/**
+ * @brief Copy the records in a leaf node that follow a given key.
+ *
+ * The native scans of BTreeOLC and its variants (e.g., OptiQL) only return
+ * payloads, so this function traverses a tree in the same manner as their
+ * `lookup` and copies keys as well to continue scanning from the last returned
+ * key. The tree must have the node layout and optimistic lock interface of
+ * BTreeOLC, and the traversal restarts from the root if any version check
+ * fails.
+ *
+ * @tparam Node_t the base class of nodes.
+ * @tparam Inner_t a class of inner nodes.
+ * @tparam Leaf_t a class of leaf nodes.
+ * @param index a target tree.
+ * @param key a begin key (inclusive).
+ * @param records the head of a buffer for scanned records.
+ * @param max_num the maximum number of scanned records.
+ * @return the number of scanned records.
+ */
+template <class Node_t, class Inner_t, class Leaf_t, class Index_t, class Key, class Payload>
+auto
+ScanLeafOptimistically(  //
+    Index_t &index,
+    const Key &key,
+    std::pair<Key, Payload> *records,
+    const size_t max_num)  //
+    -> size_t
+{
+  while (true) {
+    auto restart = false;
+    Node_t *node = index.root;
+    auto ver = node->readLockOrRestart(restart);
+    if (restart || node != index.root) continue;
+
+    Inner_t *parent = nullptr;
+    uint64_t parent_ver = 0;
+    while (node->type == Inner_t::typeMarker) {
+      auto *inner = static_cast<Inner_t *>(node);
+      if (parent != nullptr) {
+        parent->readUnlockOrRestart(parent_ver, restart);
+        if (restart) break;
+      }
+      parent = inner;
+      parent_ver = ver;
+
+      node = inner->children[inner->lowerBound(key)];
+      inner->checkOrRestart(ver, restart);
+      if (restart) break;
+      ver = node->readLockOrRestart(restart);
+      if (restart) break;
+    }
+    if (restart) continue;
+
+    auto *leaf = static_cast<Leaf_t *>(node);
+    size_t size = 0;
+    for (size_t i = leaf->lowerBound(key); i < leaf->count && size < max_num; ++i) {
+      records[size++] = {leaf->keys[i], leaf->payloads[i]};
+    }
+    if (parent != nullptr) {
+      parent->readUnlockOrRestart(parent_ver, restart);
+      if (restart) continue;
+    }
+    node->readUnlockOrRestart(ver, restart);
+    if (restart) continue;
+
+    return size;
+  }
+}
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_INDEXES_OPTIMISTIC_LEAF_SCAN_HPP
@@ -304,6 +304,14 @@ HasSetUpTearDown<YakushimaWrapper>()  //
   return true;
 }
 
+template <>
+constexpr auto
+HasEndKeyScan<YakushimaWrapper>()  //
+    -> bool
+{
+  return false;
+}
+
 }  // namespace dbgroup
 
 #endif  // INDEX_BENCHMARK_INDEXES_YAKUSHIMA_WRAPPER_HPP
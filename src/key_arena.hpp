@@ -0,0 +1,480 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_KEY_ARENA_HPP
+#define INDEX_BENCHMARK_KEY_ARENA_HPP
+
+// C++ standard libraries
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// local sources
+#include "var_len_data.hpp"
+#include "workload/length_distribution.hpp"
+#include "workload/rand_engine.hpp"
+
+namespace dbgroup
+{
+
+/*##############################################################################
+ * Global utilities
+ *############################################################################*/
+
+/**
+ * @tparam Key a class of target keys.
+ * @retval true if keys are variable-length strings in a key arena.
+ * @retval false otherwise.
+ */
+template <class Key>
+constexpr auto
+IsVarLenKey()  //
+    -> bool
+{
+  return std::is_same_v<Key, char *>;
+}
+
+/**
+ * @brief A comparator for null-terminated variable-length keys.
+ *
+ */
+struct CompareAsCString {
+  auto
+  operator()(  //
+      const char *a,
+      const char *b) const noexcept  //
+      -> bool
+  {
+    return std::strcmp(a, b) < 0;
+  }
+};
+
+/// a comparator of target keys.
+template <class Key>
+using KeyComp_t = std::conditional_t<IsVarLenKey<Key>(), CompareAsCString, std::less<Key>>;
+
+/**
+ * @brief Call a given function for each key ID in [0, key_num) with multiple threads.
+ *
+ * @param key_num the number of key IDs.
+ * @param thread_num the number of threads.
+ * @param f a function that receives a key ID.
+ */
+template <class Func>
+void
+ForEachKeyInParallel(  //
+    const size_t key_num,
+    const size_t thread_num,
+    Func &&f)
+{
+  auto worker = [&](const size_t begin_pos, const size_t end_pos) {
+    for (size_t i = begin_pos; i < end_pos; ++i) {
+      f(i);
+    }
+  };
+
+  std::vector<std::thread> threads{};
+  size_t begin_pos = 0;
+  for (size_t i = 0; i < thread_num; ++i) {
+    const size_t n = (key_num + ((thread_num - 1) - i)) / thread_num;
+    threads.emplace_back(worker, begin_pos, begin_pos + n);
+    begin_pos += n;
+  }
+  for (auto &&thread : threads) {
+    thread.join();
+  }
+}
+
+/*##############################################################################
+ * Class definitions
+ *############################################################################*/
+
+/**
+ * @brief A class for retaining variable-length keys in contiguous memory.
+ *
+ * The key of ID `i` is a null-terminated string: the fixed-width digits of `i`
+ * followed by filler characters. Thus, the order of keys is the same as the one
+ * of their IDs regardless of their lengths. The length of each key (including a
+ * terminator) is drawn from a given distribution with a random engine seeded by
+ * its ID, so the same ID always has the same key. Keys of IDs in [0, key_num)
+ * are materialized in advance, and the other ones (e.g., inserted keys) are
+ * built in a thread-local buffer on demand.
+ */
+class KeyArena
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param key_num the number of keys to be materialized.
+   * @param len_dist a distribution of key lengths.
+   * @param thread_num the number of threads to build keys.
+   */
+  KeyArena(  //
+      const size_t key_num,
+      LengthDistribution len_dist,
+      const size_t thread_num)
+      : key_num_{key_num}, len_dist_{std::move(len_dist)}, offsets_(key_num + 1, 0)
+  {
+    if (len_dist_.GetMin() < kMinKeyLen) {
+      std::string err_msg = "ERROR: the key length must be greater than or equal to ";
+      err_msg += std::to_string(kMinKeyLen);
+      err_msg += ".";
+      throw std::runtime_error{err_msg};
+    }
+
+    // compute the lengths of keys, and then their offsets
+    ForEachKeyInParallel(key_num_, thread_num,
+                         [&](const size_t i) { offsets_[i + 1] = ComputeLength(i); });
+    for (size_t i = 0; i < key_num_; ++i) {
+      offsets_[i + 1] += offsets_[i];
+    }
+
+    // build keys in contiguous memory
+    arena_ = std::make_unique<char[]>(offsets_[key_num_]);
+    ForEachKeyInParallel(key_num_, thread_num, [&](const size_t i) {
+      FillKey(i, &(arena_[offsets_[i]]), offsets_[i + 1] - offsets_[i]);
+    });
+  }
+
+  KeyArena(const KeyArena &) = delete;
+  KeyArena(KeyArena &&) = delete;
+
+  auto operator=(const KeyArena &) -> KeyArena & = delete;
+  auto operator=(KeyArena &&) -> KeyArena & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~KeyArena() = default;
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @return the number of materialized keys.
+   */
+  [[nodiscard]] constexpr auto
+  GetKeyNum() const  //
+      -> size_t
+  {
+    return key_num_;
+  }
+
+  /**
+   * @return the average length of materialized keys.
+   */
+  [[nodiscard]] auto
+  GetAverageKeyLength() const  //
+      -> double
+  {
+    return (key_num_ == 0) ? 0.0 : static_cast<double>(offsets_[key_num_]) / key_num_;
+  }
+
+  /**
+   * @param id a key ID.
+   * @return the key of the given ID (a buffer is reused after `kBufNum` calls
+   * for keys that are not materialized).
+   */
+  [[nodiscard]] auto
+  GetKey(const KeyID id) const  //
+      -> char *
+  {
+    if (id < key_num_) return &(arena_[offsets_[id]]);
+
+    thread_local std::array<std::string, kBufNum> buf{};
+    thread_local size_t pos = 0;
+    auto &key = buf[pos++ % kBufNum];
+    key.resize(ComputeLength(id));
+    FillKey(id, key.data(), key.size());
+    return key.data();
+  }
+
+  /**
+   * @param id a key ID.
+   * @return the length of the key (including a terminator).
+   */
+  [[nodiscard]] auto
+  GetKeyLength(const KeyID id) const  //
+      -> size_t
+  {
+    return (id < key_num_) ? offsets_[id + 1] - offsets_[id] : ComputeLength(id);
+  }
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Build variable-length keys used in this process.
+   *
+   * @param key_num the number of keys to be materialized.
+   * @param len_dist a distribution of key lengths.
+   * @param thread_num the number of threads to build keys.
+   */
+  static void
+  Build(  //
+      const size_t key_num,
+      LengthDistribution len_dist,
+      const size_t thread_num)
+  {
+    instance_.reset();
+    instance_ = std::make_unique<KeyArena>(key_num, std::move(len_dist), thread_num);
+  }
+
+  /**
+   * @return the key arena in use (`nullptr` if not built).
+   */
+  static auto
+  Get()  //
+      -> const KeyArena *
+  {
+    return instance_.get();
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// the number of bits represented by each digit of key IDs.
+  static constexpr size_t kDigitBitNum = 6;
+
+  /// the number of digits to represent any key ID.
+  static constexpr size_t kDigitNum = (sizeof(KeyID) * 8 + kDigitBitNum - 1) / kDigitBitNum;
+
+  /// the minimum length of keys (i.e., digits and a terminator).
+  static constexpr size_t kMinKeyLen = kDigitNum + 1;
+
+  /// the number of thread-local buffers for keys that are not materialized.
+  static constexpr size_t kBufNum = 4;
+
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  [[nodiscard]] auto
+  ComputeLength(const KeyID id) const  //
+      -> size_t
+  {
+    WyRand rand_engine{id};
+    return len_dist_(rand_engine);
+  }
+
+  /**
+   * @brief Write the key of a given ID.
+   *
+   * Each digit has six bits of an ID, and it is mapped to ['0', 'o'] so that
+   * `strcmp` and `memcmp` keep the order of IDs.
+   */
+  static void
+  FillKey(  //
+      KeyID id,
+      char *key,
+      const size_t len)
+  {
+    const auto filler = id;
+    for (size_t i = kDigitNum; i > 0; --i, id >>= kDigitBitNum) {
+      key[i - 1] = static_cast<char>('0' + (id & ((1U << kDigitBitNum) - 1U)));
+    }
+    for (size_t i = kDigitNum; i < len - 1; ++i) {
+      key[i] = static_cast<char>('a' + (filler + i) % 26);
+    }
+    key[len - 1] = '\0';
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// the number of materialized keys.
+  size_t key_num_{0};
+
+  /// a distribution of key lengths.
+  LengthDistribution len_dist_{};
+
+  /// the offset of each key in the arena (the last one is the total size).
+  std::vector<size_t> offsets_{};
+
+  /// contiguous memory for materialized keys.
+  std::unique_ptr<char[]> arena_{nullptr};
+
+  /// the key arena used in this process.
+  static inline std::unique_ptr<KeyArena> instance_{nullptr};
+};
+
+/**
+ * @brief A class for retaining fixed-length keys in cache-aligned contiguous memory.
+ *
+ * Constructing a key such as `VarLenData` costs a few `memset`s, so building
+ * keys in advance removes the cost from measured regions. Keys of IDs in
+ * [0, key_num) are materialized, and the other ones are built on demand.
+ *
+ * @tparam Key a class of target keys.
+ */
+template <class Key>
+class FixedLenKeyArena
+{
+  static_assert(std::is_trivially_copyable_v<Key>);
+
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param key_num the number of keys to be materialized.
+   * @param thread_num the number of threads to build keys.
+   * @param make_key a function to build the key of a given ID.
+   */
+  template <class MakeKey>
+  FixedLenKeyArena(  //
+      const size_t key_num,
+      const size_t thread_num,
+      MakeKey &&make_key)
+      : key_num_{key_num},
+        keys_{static_cast<Key *>(
+            ::operator new(sizeof(Key) * key_num, std::align_val_t{kCacheLineSize}))}
+  {
+    ForEachKeyInParallel(key_num_, thread_num, [&](const size_t i) {
+      new (&(keys_[i])) Key{make_key(static_cast<KeyID>(i))};
+    });
+  }
+
+  FixedLenKeyArena(const FixedLenKeyArena &) = delete;
+  FixedLenKeyArena(FixedLenKeyArena &&) = delete;
+
+  auto operator=(const FixedLenKeyArena &) -> FixedLenKeyArena & = delete;
+  auto operator=(FixedLenKeyArena &&) -> FixedLenKeyArena & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~FixedLenKeyArena() = default;
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @return the number of materialized keys.
+   */
+  [[nodiscard]] constexpr auto
+  GetKeyNum() const  //
+      -> size_t
+  {
+    return key_num_;
+  }
+
+  /**
+   * @param id a key ID less than the number of materialized keys.
+   * @return the materialized key of the given ID.
+   */
+  [[nodiscard]] auto
+  GetKey(const KeyID id) const  //
+      -> const Key &
+  {
+    return keys_[id];
+  }
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Build fixed-length keys used in this process.
+   *
+   * @param key_num the number of keys to be materialized.
+   * @param thread_num the number of threads to build keys.
+   * @param make_key a function to build the key of a given ID.
+   */
+  template <class MakeKey>
+  static void
+  Build(  //
+      const size_t key_num,
+      const size_t thread_num,
+      MakeKey &&make_key)
+  {
+    instance_.reset();
+    instance_ = std::make_unique<FixedLenKeyArena>(key_num, thread_num, make_key);
+  }
+
+  /**
+   * @return the key arena in use (`nullptr` if not built).
+   */
+  static auto
+  Get()  //
+      -> const FixedLenKeyArena *
+  {
+    return instance_.get();
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// the expected size of cache lines.
+  static constexpr size_t kCacheLineSize = 64;
+
+  /*############################################################################
+   * Internal classes
+   *##########################################################################*/
+
+  /**
+   * @brief A deleter for keys allocated with the alignment of cache lines.
+   *
+   */
+  struct AlignedDeleter {
+    void
+    operator()(Key *keys) const
+    {
+      ::operator delete(keys, std::align_val_t{kCacheLineSize});
+    }
+  };
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// the number of materialized keys.
+  size_t key_num_{0};
+
+  /// contiguous memory for materialized keys.
+  std::unique_ptr<Key[], AlignedDeleter> keys_{nullptr};
+
+  /// the key arena used in this process.
+  static inline std::unique_ptr<FixedLenKeyArena> instance_{nullptr};
+};
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_KEY_ARENA_HPP
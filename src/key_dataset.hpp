@@ -0,0 +1,250 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_KEY_DATASET_HPP
+#define INDEX_BENCHMARK_KEY_DATASET_HPP
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// system libraries
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// local sources
+#include "var_len_data.hpp"
+
+namespace dbgroup
+{
+
+/**
+ * @brief A class for mapping key IDs to the keys of a real dataset.
+ *
+ * A dataset file has the SOSD format: the number of keys as `uint64_t` followed
+ * by sorted `uint64_t` keys. The file is memory-mapped without copying, and the
+ * i-th key is used as the key of ID `i`. Since the keys are sorted, the order
+ * of key IDs is kept. Since some datasets (e.g., SOSD `wiki`) contain duplicate
+ * keys, adjacent equal keys are merged into one key ID (i.e., such a dataset is
+ * copied into memory without duplicates). Key IDs beyond the dataset (e.g.,
+ * inserted or absent keys) are extrapolated after the maximum key. Since dataset
+ * keys have 64 bits, they can only be used as integer keys.
+ */
+class KeyDataset
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param path the path to a SOSD-format dataset.
+   */
+  explicit KeyDataset(const std::string &path)
+  {
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error{"ERROR: the dataset (" + path + ") cannot be opened."};
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < 2 * sizeof(uint64_t)) {
+      ::close(fd);
+      throw std::runtime_error{"ERROR: the dataset (" + path + ") is too short."};
+    }
+    file_size_ = st.st_size;
+
+    addr_ = ::mmap(nullptr, file_size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr_ == MAP_FAILED) {
+      addr_ = nullptr;
+      throw std::runtime_error{"ERROR: the dataset (" + path + ") cannot be mapped."};
+    }
+    ::madvise(addr_, file_size_, MADV_WILLNEED);
+
+    // check the given file has sorted keys
+    const auto *head = reinterpret_cast<const uint64_t *>(addr_);
+    key_num_ = head[0];
+    keys_ = head + 1;
+    if (key_num_ == 0 || key_num_ > file_size_ / sizeof(uint64_t) - 1) {
+      Unmap();
+      throw std::runtime_error{"ERROR: the dataset (" + path + ") has an invalid key count."};
+    }
+    size_t dup_num = 0;
+    for (size_t i = 1; i < key_num_; ++i) {
+      if (keys_[i - 1] > keys_[i]) {
+        Unmap();
+        throw std::runtime_error{"ERROR: the dataset (" + path + ") has unsorted keys."};
+      }
+      dup_num += static_cast<size_t>(keys_[i - 1] == keys_[i]);
+    }
+    if (dup_num == 0) return;
+
+    // copy the keys without duplicates to keep key IDs dense
+    unique_keys_.reserve(key_num_ - dup_num);
+    unique_keys_.emplace_back(keys_[0]);
+    for (size_t i = 1; i < key_num_; ++i) {
+      if (keys_[i] != unique_keys_.back()) {
+        unique_keys_.emplace_back(keys_[i]);
+      }
+    }
+    Unmap();
+    keys_ = unique_keys_.data();
+    key_num_ = unique_keys_.size();
+  }
+
+  KeyDataset(const KeyDataset &) = delete;
+  KeyDataset(KeyDataset &&) = delete;
+
+  auto operator=(const KeyDataset &) -> KeyDataset & = delete;
+  auto operator=(KeyDataset &&) -> KeyDataset & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~KeyDataset() { Unmap(); }
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @return the number of keys in this dataset.
+   */
+  [[nodiscard]] constexpr auto
+  GetKeyNum() const  //
+      -> size_t
+  {
+    return key_num_;
+  }
+
+  /**
+   * @return a hash value of the first, middle, and last keys in this dataset.
+   */
+  [[nodiscard]] auto
+  GetFingerprint() const  //
+      -> uint64_t
+  {
+    uint64_t hash = key_num_;
+    for (const auto pos : {0UL, key_num_ / 2, key_num_ - 1}) {
+      hash = (hash ^ keys_[pos]) * 0x100000001B3UL;  // FNV-1a style mixing
+    }
+    return hash;
+  }
+
+  /**
+   * @tparam Key a class of target keys.
+   * @param id a key ID.
+   * @return the key of the given ID.
+   */
+  template <class Key>
+  [[nodiscard]] auto
+  GetKey(const KeyID id) const  //
+      -> Key
+  {
+    static_assert(std::is_integral_v<Key> && sizeof(Key) >= sizeof(uint64_t));
+
+    return (id < key_num_) ? keys_[id] : keys_[key_num_ - 1] + (id - key_num_ + 1);
+  }
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Check that the keys of given IDs can be extrapolated without wrapping around.
+   *
+   * @param max_id the maximum key ID used in a workload.
+   */
+  void
+  CheckMaxKeyID(const uint64_t max_id) const
+  {
+    constexpr auto kMaxKey = std::numeric_limits<uint64_t>::max();
+    if (max_id >= key_num_ && keys_[key_num_ - 1] > kMaxKey - (max_id - key_num_ + 1)) {
+      throw std::runtime_error{"ERROR: the dataset has too large keys for the used key IDs."};
+    }
+  }
+
+  /**
+   * @brief Use the given dataset for all the keys in this process.
+   *
+   * @param path the path to a SOSD-format dataset.
+   */
+  static void
+  Load(const std::string &path)
+  {
+    instance_ = std::make_unique<KeyDataset>(path);
+  }
+
+  /**
+   * @return the dataset in use (`nullptr` if keys are generated from IDs).
+   */
+  static auto
+  Get()  //
+      -> const KeyDataset *
+  {
+    return instance_.get();
+  }
+
+ private:
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  void
+  Unmap()
+  {
+    if (addr_ != nullptr) {
+      ::munmap(addr_, file_size_);
+      addr_ = nullptr;
+    }
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// the head address of a mapped file.
+  void *addr_{nullptr};
+
+  /// the size of a mapped file.
+  size_t file_size_{0};
+
+  /// the sorted unique keys (in the mapped file or `unique_keys_`).
+  const uint64_t *keys_{nullptr};
+
+  /// the keys copied without duplicates (empty if the dataset has no duplicates).
+  std::vector<uint64_t> unique_keys_{};
+
+  /// the number of keys in this dataset.
+  size_t key_num_{0};
+
+  /// the dataset used in this process.
+  static inline std::unique_ptr<KeyDataset> instance_{nullptr};
+};
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_KEY_DATASET_HPP
@@ -0,0 +1,161 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_LATENCY_HPP
+#define INDEX_BENCHMARK_LATENCY_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup
+{
+
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+/// the percentiles of latency to be reported.
+constexpr std::array<double, 7> kPercentiles = {0.0, 0.50, 0.90, 0.95, 0.99, 0.999, 1.0};
+
+/// the labels of reported percentiles.
+constexpr std::array<const char *, 7> kPercentileLabels = {"MIN",  "50",   "90", "95",
+                                                           "99",   "99.9", "MAX"};
+
+/// the number of buckets to classify scan lengths.
+constexpr size_t kScanBucketNum = kOpsValueBitNum;
+
+/// the maximum number of latencies retained by each worker.
+constexpr size_t kMaxLatencyNum = 1UL << 20UL;
+
+/*##############################################################################
+ * Type aliases
+ *############################################################################*/
+
+/// a sequence of measured latencies in nanoseconds.
+using Latencies_t = std::vector<int64_t>;
+
+/// the latencies at `kPercentiles`.
+using Percentiles_t = std::array<int64_t, kPercentiles.size()>;
+
+/*##############################################################################
+ * Global utilities
+ *############################################################################*/
+
+/**
+ * @param len a scan length.
+ * @return the bucket of scan lengths in [2^b, 2^(b+1)) (zero is in the first one).
+ */
+constexpr auto
+GetScanBucket(const size_t len)  //
+    -> size_t
+{
+  size_t b = 0;
+  while ((len >> (b + 1)) > 0) {
+    ++b;
+  }
+  return b;
+}
+
+/**
+ * @brief Retain a latency with keeping a uniform sample of all the latencies.
+ *
+ * @param lat retained latencies.
+ * @param latency a measured latency.
+ * @param measured_num the number of latencies measured before the given one.
+ * @param rand_engine a random engine for sampling.
+ */
+inline void
+SampleLatency(  //
+    Latencies_t &lat,
+    const int64_t latency,
+    const size_t measured_num,
+    std::mt19937_64 &rand_engine)
+{
+  if (measured_num < kMaxLatencyNum) {
+    lat.emplace_back(latency);
+    return;
+  }
+  const auto pos = std::uniform_int_distribution<size_t>{0, measured_num}(rand_engine);
+  if (pos < kMaxLatencyNum) {
+    lat[pos] = latency;
+  }
+}
+
+/**
+ * @param latencies measured latencies (they are sorted in this function).
+ * @return the latencies at `kPercentiles` (all zeros if no latency is given).
+ */
+inline auto
+ComputePercentiles(Latencies_t &latencies)  //
+    -> Percentiles_t
+{
+  Percentiles_t ret{};
+  if (latencies.empty()) return ret;
+
+  std::sort(latencies.begin(), latencies.end());
+  for (size_t i = 0; i < ret.size(); ++i) {
+    const auto pos = static_cast<size_t>(kPercentiles[i] * (latencies.size() - 1));
+    ret[i] = latencies[pos];
+  }
+  return ret;
+}
+
+/**
+ * @brief Output the percentiled latencies of scans for each range of lengths.
+ *
+ * The results are only output in text format to keep the CSV format of latency.
+ *
+ * @param scan_nums the number of scans in each range.
+ * @param scan_latencies the sampled latencies of scans in each range.
+ */
+inline void
+OutputScanLatencies(  //
+    const std::vector<size_t> &scan_nums,
+    std::vector<Latencies_t> &scan_latencies)
+{
+  auto has_scan = false;
+  for (size_t b = 0; b < kScanBucketNum; ++b) {
+    auto &latencies = scan_latencies[b];
+    if (latencies.empty()) continue;
+
+    if (!has_scan) {
+      std::cout << "  Percentiled latencies of scans by length [ns]:" << std::endl
+                << "    (lengths: count, MIN, 50, 90, 95, 99, 99.9, MAX)" << std::endl;
+    }
+    has_scan = true;
+
+    const size_t lo = (b == 0) ? 0 : (1UL << b);
+    const size_t hi = (1UL << (b + 1)) - 1;
+    std::cout << "    [" << lo << ", " << hi << "]: " << scan_nums[b];
+    for (const auto lat : ComputePercentiles(latencies)) {
+      std::cout << ", " << lat;
+    }
+    std::cout << std::endl;
+  }
+}
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_LATENCY_HPP
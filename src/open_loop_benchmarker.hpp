@@ -0,0 +1,338 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_OPEN_LOOP_BENCHMARKER_HPP
+#define INDEX_BENCHMARK_OPEN_LOOP_BENCHMARKER_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// local sources
+#include "common.hpp"
+#include "latency.hpp"
+
+namespace dbgroup
+{
+
+/**
+ * @brief A class for measuring latency under a fixed offered load (open loop).
+ *
+ * Each worker issues operations according to its own arrival schedule instead
+ * of issuing the next one just after the previous one completes. Latency is
+ * measured from the intended send time of each operation, so queueing delay is
+ * included even if a worker falls behind its schedule (i.e., this class avoids
+ * coordinated omission). The keys of a batch of multi reads are issued at once
+ * when the last one arrives, and each of them is measured from its own intended
+ * send time. If the timeout stops a worker behind its schedule, the operations
+ * that were scheduled before the timeout but not issued are recorded with their
+ * delays until the timeout and reported as dropped ones. If the schedule ends in
+ * the middle of a batch while a worker keeps up with it, the batch is not issued
+ * like the operations scheduled after the timeout. The latency of scan
+ * operations is also reported for each power-of-two range of scan lengths. Each
+ * worker retains a uniform sample of at most `kMaxLatencyNum` latencies for all
+ * the operations and for each range.
+ *
+ * @tparam Index_t a class of target indexes.
+ * @tparam OperationEngine_t a class to generate operation-queues.
+ */
+template <class Index_t, class OperationEngine_t>
+class OpenLoopBenchmarker
+{
+  /*############################################################################
+   * Type aliases
+   *##########################################################################*/
+
+  using Clock_t = std::chrono::steady_clock;
+
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  OpenLoopBenchmarker(  //
+      Index_t &index,
+      std::string target_name,
+      OperationEngine_t &ops_engine,
+      const size_t exec_num,
+      const size_t thread_num,
+      const size_t random_seed,
+      const double target_rate,
+      const bool use_poisson,
+      const double record_size,
+      const bool output_as_csv,
+      const size_t timeout_in_sec)
+      : index_{index},
+        target_name_{std::move(target_name)},
+        ops_engine_{ops_engine},
+        exec_num_{exec_num},
+        thread_num_{thread_num},
+        random_seed_{random_seed},
+        target_rate_{target_rate},
+        use_poisson_{use_poisson},
+        record_size_{record_size},
+        output_as_csv_{output_as_csv},
+        timeout_{std::chrono::seconds{timeout_in_sec}}
+  {
+  }
+
+  OpenLoopBenchmarker(const OpenLoopBenchmarker &) = delete;
+  OpenLoopBenchmarker(OpenLoopBenchmarker &&) = delete;
+
+  auto operator=(const OpenLoopBenchmarker &) -> OpenLoopBenchmarker & = delete;
+  auto operator=(OpenLoopBenchmarker &&) -> OpenLoopBenchmarker & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~OpenLoopBenchmarker() = default;
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Issue operations by the arrival schedules and output latency.
+   *
+   */
+  void
+  Run()
+  {
+    std::vector<Latencies_t> latencies(thread_num_);
+    std::vector<std::vector<Latencies_t>> scan_latencies(thread_num_);
+    std::vector<std::vector<size_t>> scan_nums(thread_num_);
+    std::vector<size_t> exec_nums(thread_num_, 0);
+    std::vector<size_t> dropped_nums(thread_num_, 0);
+    std::atomic_size_t ready_num{0};
+    std::atomic_bool is_running{false};
+    Clock_t::time_point start{};
+
+    // a lambda function to execute operations in each worker
+    auto worker = [&](const size_t i, const size_t seed) {
+      std::mt19937_64 rand_engine{seed};
+      auto &&stream = ops_engine_.GenerateStream(exec_num_, rand_engine());
+      std::mt19937_64 sample_engine{rand_engine()};
+      Latencies_t lat{};
+      std::vector<Latencies_t> scan_lat(kScanBucketNum);
+      std::vector<size_t> scan_num(kScanBucketNum, 0);
+      const auto rate = target_rate_ / thread_num_ / 1e9;  // per nanosecond
+      std::exponential_distribution<double> poisson_dist{rate};
+      size_t measured_num = 0;
+      size_t dropped_num = 0;
+      Clock_t::time_point stop{};
+
+      index_.SetUpForWorker();
+      ready_num.fetch_add(1);
+      while (!is_running.load()) {
+        std::this_thread::yield();
+      }
+
+      double intended_ns = 0;
+      std::array<Clock_t::time_point, kMaxMultiReadSize> intended{};
+      stream.ForEachChunk([&](const auto *ops, const size_t n) {
+        for (size_t j = 0; j < n;) {
+          const auto m = Index_t::GetUnitSize(&(ops[j]), n - j);
+          size_t scheduled = 0;
+          for (; scheduled < m; ++scheduled) {
+            intended_ns += (use_poisson_) ? poisson_dist(rand_engine) : 1.0 / rate;
+            const auto intended_time = std::chrono::nanoseconds{static_cast<int64_t>(intended_ns)};
+            intended[scheduled] = start + intended_time;
+            if (intended_time > timeout_) break;  // the schedule ends at the timeout
+          }
+
+          auto now = (dropped_num > 0) ? stop : Clock_t::now();
+          if (dropped_num > 0 || now - start > timeout_) {
+            // the worker is behind at the timeout, so record delays until the timeout at least
+            stop = now;
+            for (size_t k = 0; k < scheduled; ++k) {
+              const auto latency = std::chrono::nanoseconds{stop - intended[k]}.count();
+              SampleLatency(lat, latency, measured_num++, sample_engine);
+              ++dropped_num;
+            }
+            if (scheduled < m) return false;
+            j += m;
+            continue;
+          }
+          if (scheduled < m) return false;  // the schedule ends in the middle of a batch
+
+          while (now < intended[m - 1]) {
+            now = Clock_t::now();  // wait for the intended send time
+          }
+          if (m > 1) {
+            index_.ExecuteAll(&(ops[j]), m, kMultiRead);
+          } else {
+            index_.Execute(ops[j]);
+          }
+          const auto end = Clock_t::now();
+          for (size_t k = 0; k < m; ++k) {
+            const auto latency = std::chrono::nanoseconds{end - intended[k]}.count();
+            SampleLatency(lat, latency, measured_num++, sample_engine);
+          }
+          const auto type = ops[j].GetType();
+          if (type == kScan || type == kRangeScan || type == kReverseScan) {
+            const auto latency = std::chrono::nanoseconds{end - intended[0]}.count();
+            const auto b = GetScanBucket(ops[j].GetValue());
+            SampleLatency(scan_lat[b], latency, scan_num[b]++, sample_engine);
+          }
+          j += m;
+        }
+        return true;
+      });
+      index_.TearDownForWorker();
+      latencies.at(i) = std::move(lat);
+      scan_latencies.at(i) = std::move(scan_lat);
+      scan_nums.at(i) = std::move(scan_num);
+      exec_nums.at(i) = measured_num - dropped_num;
+      dropped_nums.at(i) = dropped_num;
+    };
+
+    // prepare workers and start their schedules at the same time
+    if (!output_as_csv_) {
+      std::cout << "...Prepare workers for benchmarking." << std::endl;
+    }
+    std::mt19937_64 rand_engine{random_seed_};
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < thread_num_; ++i) {
+      threads.emplace_back(worker, i, rand_engine());
+    }
+    while (ready_num.load() < thread_num_) {
+      std::this_thread::yield();
+    }
+    if (!output_as_csv_) {
+      std::cout << "...Run workers." << std::endl;
+    }
+    start = Clock_t::now();
+    is_running.store(true);
+    for (auto &&t : threads) {
+      t.join();
+    }
+    auto elapsed = std::chrono::duration<double>{Clock_t::now() - start}.count();
+
+    // merge the results of all the workers
+    Latencies_t merged{};
+    std::vector<Latencies_t> scan_merged(kScanBucketNum);
+    std::vector<size_t> scan_merged_nums(kScanBucketNum, 0);
+    size_t exec_num = 0;
+    size_t dropped_num = 0;
+    for (size_t i = 0; i < thread_num_; ++i) {
+      merged.insert(merged.end(), latencies[i].begin(), latencies[i].end());
+      for (size_t b = 0; b < kScanBucketNum; ++b) {
+        const auto &lat = scan_latencies[i][b];
+        scan_merged[b].insert(scan_merged[b].end(), lat.begin(), lat.end());
+        scan_merged_nums[b] += scan_nums[i][b];
+      }
+      exec_num += exec_nums[i];
+      dropped_num += dropped_nums[i];
+    }
+    if (dropped_num > 0) {
+      // workers issued operations until the timeout
+      elapsed = std::chrono::duration<double>{timeout_}.count();
+    }
+    Output(exec_num / elapsed, dropped_num, merged);
+    if (!output_as_csv_) {
+      OutputScanLatencies(scan_merged_nums, scan_merged);
+    }
+  }
+
+ private:
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  void
+  Output(  //
+      const double throughput,
+      const size_t dropped_num,
+      Latencies_t &latencies) const
+  {
+    const auto &percentiles = ComputePercentiles(latencies);
+    if (output_as_csv_) {
+      std::cout << target_rate_ << "," << throughput << "," << throughput * record_size_ << ","
+                << dropped_num;
+    } else {
+      std::cout << "*** RESULTS ***" << std::endl
+                << target_name_ << std::endl
+                << "  Offered load: " << target_rate_ << " ops/s" << std::endl
+                << "  Achieved throughput: " << throughput << " ops/s ("
+                << throughput * record_size_ << " bytes/s)" << std::endl;
+      if (dropped_num > 0) {
+        std::cout << "  Dropped operations at the timeout: " << dropped_num << std::endl;
+      }
+      std::cout << "  Percentiled latencies from intended send times [ns]:" << std::endl;
+    }
+    for (size_t i = 0; i < percentiles.size(); ++i) {
+      if (output_as_csv_) {
+        std::cout << "," << percentiles[i];
+      } else {
+        std::cout << "    " << kPercentileLabels[i] << ": " << percentiles[i] << std::endl;
+      }
+    }
+    if (output_as_csv_) {
+      std::cout << std::endl;
+    }
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// a target index.
+  Index_t &index_;
+
+  /// the name of a target index.
+  std::string target_name_{};
+
+  /// an engine to generate operation-queues.
+  OperationEngine_t &ops_engine_;
+
+  /// the maximum number of operations for each worker.
+  size_t exec_num_{0};
+
+  /// the number of worker threads.
+  size_t thread_num_{1};
+
+  /// a random seed to generate workloads and arrival schedules.
+  size_t random_seed_{0};
+
+  /// the total number of operations per second issued by all the workers.
+  double target_rate_{0};
+
+  /// a flag for using Poisson arrivals instead of constant intervals.
+  bool use_poisson_{true};
+
+  /// the average number of bytes of a record to report throughput in bytes/s.
+  double record_size_{0};
+
+  /// a flag for outputting results in CSV format.
+  bool output_as_csv_{false};
+
+  /// the maximum duration of issuing operations.
+  std::chrono::nanoseconds timeout_{};
+};
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_OPEN_LOOP_BENCHMARKER_HPP
@@ -0,0 +1,201 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_TIMED_BENCHMARKER_HPP
+#define INDEX_BENCHMARK_TIMED_BENCHMARKER_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dbgroup
+{
+
+/**
+ * @brief A class for measuring throughput of duration-based phases.
+ *
+ * Each worker consumes an operation stream that follows a shared phase clock,
+ * so all the workers switch phases at the same deadlines. The throughput of
+ * each phase is computed by the operations executed before its deadline. If a
+ * phase has thread groups, the throughput of each group is also reported.
+ *
+ * @tparam Index_t a class of target indexes.
+ * @tparam OperationEngine_t a class to generate operation streams.
+ */
+template <class Index_t, class OperationEngine_t>
+class TimedBenchmarker
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  TimedBenchmarker(  //
+      Index_t &index,
+      std::string target_name,
+      OperationEngine_t &ops_engine,
+      const size_t thread_num,
+      const size_t random_seed,
+      const double record_size,
+      const bool output_as_csv)
+      : index_{index},
+        target_name_{std::move(target_name)},
+        ops_engine_{ops_engine},
+        thread_num_{thread_num},
+        random_seed_{random_seed},
+        record_size_{record_size},
+        output_as_csv_{output_as_csv}
+  {
+  }
+
+  TimedBenchmarker(const TimedBenchmarker &) = delete;
+  TimedBenchmarker(TimedBenchmarker &&) = delete;
+
+  auto operator=(const TimedBenchmarker &) -> TimedBenchmarker & = delete;
+  auto operator=(TimedBenchmarker &&) -> TimedBenchmarker & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~TimedBenchmarker() = default;
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Run all the phases and output the throughput of each phase.
+   *
+   */
+  void
+  Run()
+  {
+    const auto &clock = ops_engine_.GetPhaseClock();
+    const auto phase_num = clock->GetPhaseNum();
+    std::vector<std::vector<std::vector<size_t>>> exec_nums(thread_num_);
+    std::atomic_size_t ready_num{0};
+    std::atomic_bool is_running{false};
+
+    // a lambda function to execute operations in each worker
+    auto worker = [&](const size_t i, const size_t seed) {
+      auto &&stream = ops_engine_.GenerateTimedStream(seed);
+      index_.SetUpForWorker();
+      ready_num.fetch_add(1);
+      while (!is_running.load()) {
+        std::this_thread::yield();
+      }
+
+      std::vector<std::vector<size_t>> counts(phase_num);
+      for (size_t p = 0; p < phase_num; ++p) {
+        counts[p].resize(std::max<size_t>(ops_engine_.GetThreadGroupNames(p).size(), 1), 0);
+      }
+      stream.ForEachChunk([&](const auto *ops, const size_t n) {
+        const auto single_ops = stream.GetSingleOperation();
+        counts[stream.GetPhase()][stream.GetGroup()] += index_.ExecuteAll(ops, n, single_ops);
+      });
+      index_.TearDownForWorker();
+      exec_nums.at(i) = std::move(counts);
+    };
+
+    // prepare workers and start the first phase at the same time
+    if (!output_as_csv_) {
+      std::cout << "...Prepare workers for benchmarking." << std::endl;
+    }
+    std::mt19937_64 rand_engine{random_seed_};
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < thread_num_; ++i) {
+      threads.emplace_back(worker, i, rand_engine());
+    }
+    while (ready_num.load() < thread_num_) {
+      std::this_thread::yield();
+    }
+    if (!output_as_csv_) {
+      std::cout << "...Run workers." << std::endl;
+    }
+    clock->Start();
+    is_running.store(true);
+    for (auto &&t : threads) {
+      t.join();
+    }
+
+    // output the throughput of each phase
+    if (!output_as_csv_) {
+      std::cout << "*** RESULTS ***" << std::endl;
+    }
+    for (size_t p = 0; p < phase_num; ++p) {
+      const auto &names = ops_engine_.GetThreadGroupNames(p);
+      std::vector<size_t> sums(std::max<size_t>(names.size(), 1), 0);
+      for (const auto &counts : exec_nums) {
+        for (size_t g = 0; g < sums.size(); ++g) {
+          sums[g] += counts[p][g];
+        }
+      }
+      const auto duration = clock->GetDuration(p);
+      const auto throughput = std::accumulate(sums.begin(), sums.end(), 0UL) / duration;
+      if (output_as_csv_) {
+        std::cout << p << "," << throughput << "," << throughput * record_size_ << std::endl;
+      } else {
+        std::cout << target_name_ << " (phase " << p << "): " << throughput << " ops/s ("
+                  << throughput * record_size_ << " bytes/s)" << std::endl;
+      }
+      for (size_t g = 0; g < names.size(); ++g) {
+        if (output_as_csv_) {
+          std::cout << p << "," << names[g] << "," << sums[g] / duration << std::endl;
+        } else {
+          std::cout << "  " << names[g] << ": " << sums[g] / duration << " ops/s" << std::endl;
+        }
+      }
+    }
+  }
+
+ private:
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// a target index.
+  Index_t &index_;
+
+  /// the name of a target index.
+  std::string target_name_{};
+
+  /// an engine to generate operation streams.
+  OperationEngine_t &ops_engine_;
+
+  /// the number of worker threads.
+  size_t thread_num_{1};
+
+  /// a random seed to generate workloads.
+  size_t random_seed_{0};
+
+  /// the average number of bytes of a record to report throughput in bytes/s.
+  double record_size_{0};
+
+  /// a flag for outputting results in CSV format.
+  bool output_as_csv_{false};
+};
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_TIMED_BENCHMARKER_HPP
@@ -27,6 +27,22 @@
 namespace dbgroup
 {
 
+/*##############################################################################
+ * Type aliases
+ *############################################################################*/
+
+#ifdef INDEX_BENCH_USE_64BIT_KEY_IDS
+/// an integer to identify each key (i.e., a seed to create a key).
+using KeyID = uint64_t;
+#else
+/// an integer to identify each key (i.e., a seed to create a key).
+using KeyID = uint32_t;
+#endif
+
+/*##############################################################################
+ * Class definitions
+ *############################################################################*/
+
 template <size_t kDataLen>
 class VarLenData
 {
@@ -37,7 +53,7 @@ class VarLenData
 
   constexpr VarLenData() = default;
 
-  explicit VarLenData(const uint32_t seed) { Extend(seed); }
+  explicit VarLenData(const KeyID seed) { Extend(seed); }
 
   constexpr VarLenData(const VarLenData &) = default;
   constexpr VarLenData(VarLenData &&) noexcept = default;
@@ -79,7 +95,7 @@ class VarLenData
   operator+(const size_t val) const  //
       -> VarLenData
   {
-    const auto new_seed = Compress() + static_cast<uint32_t>(val);
+    const auto new_seed = Compress() + static_cast<KeyID>(val);
     return VarLenData{new_seed};
   }
 
@@ -96,7 +112,7 @@ class VarLenData
    *##########################################################################*/
 
   static constexpr size_t kWordSize = 8;
-  static constexpr size_t kSeedSize = sizeof(uint32_t);
+  static constexpr size_t kSeedSize = sizeof(KeyID);
   static constexpr size_t kSeedBitNum = 8;
   static constexpr size_t kPartLen = kDataLen / kSeedSize;
   static constexpr size_t kCopyLen = (kPartLen <= kWordSize) ? kPartLen : kWordSize;
@@ -107,9 +123,17 @@ class VarLenData
    *##########################################################################*/
 
   void
-  Extend(const uint32_t val)
+  Extend(const KeyID val)
   {
     const auto *arr = reinterpret_cast<const uint8_t *>(&val);
+    if constexpr (kCopyNum > kSeedBitNum) {
+      // each bit cannot be split into copies, so fill each part with a seed byte
+      for (size_t i = 0, j = kDataLen - kPartLen; i < kSeedSize; ++i, j -= kPartLen) {
+        memset(&(data_[j]), arr[i], kPartLen);
+      }
+      return;
+    }
+
     for (size_t i = 0, j = kDataLen - kCopyLen; i < kSeedSize; ++i) {
       if constexpr (kCopyNum <= 1) {
         memset(&(data_[j]), arr[i], kCopyLen);
@@ -129,10 +153,17 @@ class VarLenData
 
   constexpr auto
   Compress() const  //
-      -> uint32_t
+      -> KeyID
   {
-    uint32_t val{0};
+    KeyID val{0};
     auto *arr = reinterpret_cast<uint8_t *>(&val);
+    if constexpr (kCopyNum > kSeedBitNum) {
+      for (size_t i = 0, j = kDataLen - kPartLen; i < kSeedSize; ++i, j -= kPartLen) {
+        arr[i] = data_[j];
+      }
+      return val;
+    }
+
     for (size_t i = 0, j = kDataLen - kCopyLen; i < kSeedSize; ++i) {
       if constexpr (kCopyNum <= 1) {
         arr[i] = data_[j];
@@ -0,0 +1,166 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_WORKLOAD_ALIAS_TABLE_HPP
+#define INDEX_BENCHMARK_WORKLOAD_ALIAS_TABLE_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace dbgroup
+{
+
+/**
+ * @brief A class for sampling weighted items in constant time (Vose's alias method).
+ *
+ * Each column of the table holds an item, an alias item, and the probability of
+ * selecting the former. Thus, a sample is determined by one uniform random value
+ * without any search.
+ *
+ * @tparam T a class of items to be sampled.
+ */
+template <class T>
+class AliasTable
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  AliasTable() = default;
+
+  /**
+   * @param weights pairs of items and their non-negative weights.
+   */
+  explicit AliasTable(const std::vector<std::pair<T, double>> &weights)
+  {
+    const auto n = weights.size();
+    double sum = 0;
+    for (const auto &[item, w] : weights) {
+      if (w < 0) throw std::runtime_error{"ERROR: a weight must be non-negative."};
+      sum += w;
+    }
+    if (n == 0 || sum <= 0) throw std::runtime_error{"ERROR: no item can be sampled."};
+
+    // scale weights so that the average of them is one
+    items_.reserve(n);
+    aliases_.reserve(n);
+    probs_.reserve(n);
+    std::vector<double> scaled{};
+    scaled.reserve(n);
+    std::vector<size_t> small{};
+    std::vector<size_t> large{};
+    for (size_t i = 0; i < n; ++i) {
+      items_.emplace_back(weights[i].first);
+      aliases_.emplace_back(weights[i].first);
+      probs_.emplace_back(1.0);
+      scaled.emplace_back(weights[i].second * n / sum);
+      (scaled.back() < 1.0 ? small : large).emplace_back(i);
+    }
+
+    // fill each short column with the remainder of a tall one
+    while (!small.empty() && !large.empty()) {
+      const auto s = small.back();
+      const auto l = large.back();
+      small.pop_back();
+      probs_[s] = scaled[s];
+      aliases_[s] = items_[l];
+      scaled[l] -= 1.0 - scaled[s];
+      if (scaled[l] < 1.0) {
+        large.pop_back();
+        small.emplace_back(l);
+      }
+    }
+    // the remaining columns are full except for rounding errors
+  }
+
+  AliasTable(const AliasTable &) = default;
+  AliasTable(AliasTable &&) noexcept = default;
+
+  auto operator=(const AliasTable &) -> AliasTable & = default;
+  auto operator=(AliasTable &&) noexcept -> AliasTable & = default;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~AliasTable() = default;
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @param rand_val a uniform random value in [0, 1).
+   * @return a sampled item.
+   */
+  [[nodiscard]] auto
+  Sample(const double rand_val) const  //
+      -> T
+  {
+    const auto n = items_.size();
+    const auto pos = rand_val * n;
+    const auto i = std::min(static_cast<size_t>(pos), n - 1);
+    return (pos - i < probs_[i]) ? items_[i] : aliases_[i];
+  }
+
+  /**
+   * @brief Fill a buffer with sampled items.
+   *
+   * The sampled items are the same as ones given by calling `Sample` with
+   * `std::uniform_real_distribution<double>{0, 1}` for each element.
+   *
+   * @tparam RandEngine a class of random engines.
+   * @param out a buffer to write sampled items.
+   * @param n the number of items to be sampled.
+   * @param rand_engine a random engine.
+   */
+  template <class RandEngine>
+  void
+  Fill(  //
+      T *out,
+      const size_t n,
+      RandEngine &rand_engine) const
+  {
+    std::uniform_real_distribution<double> dist{0.0, 1.0};
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = Sample(dist(rand_engine));
+    }
+  }
+
+ private:
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// the primary item of each column.
+  std::vector<T> items_{};
+
+  /// the alias item of each column.
+  std::vector<T> aliases_{};
+
+  /// the probability of selecting the primary item in each column.
+  std::vector<double> probs_{};
+};
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_WORKLOAD_ALIAS_TABLE_HPP
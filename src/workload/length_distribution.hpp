@@ -0,0 +1,248 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_WORKLOAD_LENGTH_DISTRIBUTION_HPP
+#define INDEX_BENCHMARK_WORKLOAD_LENGTH_DISTRIBUTION_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// external sources
+#include "nlohmann/json.hpp"
+#include "random/zipf.hpp"
+
+// local sources
+#include "alias_table.hpp"
+
+namespace dbgroup
+{
+
+/**
+ * @brief A class for sampling lengths (e.g., of scans or keys) from a distribution.
+ *
+ * A length is given as a fixed number, `{"uniform": {"min": a, "max": b}}`,
+ * `{"zipf": {"min": a, "max": b, "skew parameter": s}}` (shorter lengths are
+ * more frequent, and `min` is one by default), or a weighted histogram such as
+ * `{"histogram": {"<length>": <weight>, ...}}`. Sampling does not modify this
+ * object, so it can be shared among threads.
+ */
+class LengthDistribution
+{
+  /*############################################################################
+   * Type aliases
+   *##########################################################################*/
+
+  using Json_t = ::nlohmann::json;
+  using Uniform_t = std::uniform_int_distribution<size_t>;
+  using ApproxZipf_t = ::dbgroup::random::ApproxZipfDistribution<size_t>;
+  using Histogram_t = AliasTable<size_t>;
+  using Dist_t = std::variant<std::monostate, Uniform_t, ApproxZipf_t, Histogram_t>;
+
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  LengthDistribution() = default;
+
+  /**
+   * @param len_json a fixed length or a distribution of lengths.
+   * @param target the name of lengths for error messages (e.g., "scan length").
+   */
+  LengthDistribution(  //
+      const Json_t &len_json,
+      const std::string &target)
+  {
+    double skew = 0;
+    std::vector<std::pair<size_t, double>> weights{};
+    if (len_json.is_number()) {
+      min_ = len_json;
+      max_ = min_;
+    } else if (len_json.contains("uniform")) {
+      const auto &uni = len_json.at("uniform");
+      min_ = uni.at("min");
+      max_ = uni.at("max");
+      if (min_ > max_) {
+        throw std::runtime_error{"ERROR: the minimum " + target + " exceeds the maximum one."};
+      }
+      dist_ = Uniform_t{min_, max_};
+    } else if (len_json.contains("zipf")) {
+      const auto &zipf = len_json.at("zipf");
+      min_ = zipf.value("min", 1UL);
+      max_ = zipf.at("max");
+      if (min_ == 0 || min_ > max_) {
+        throw std::runtime_error{"ERROR: the " + target + " range of Zipf's law is invalid."};
+      }
+      skew = zipf.value("skew parameter", 1.0);
+      dist_ = ApproxZipf_t{min_, max_, skew};
+    } else if (len_json.contains("histogram")) {
+      min_ = std::numeric_limits<size_t>::max();
+      max_ = 0;
+      for (const auto &[len, weight] : len_json.at("histogram").items()) {
+        const auto length = std::stoul(len);
+        min_ = std::min<size_t>(min_, length);
+        max_ = std::max<size_t>(max_, length);
+        weights.emplace_back(length, weight.get<double>());
+      }
+      dist_ = Histogram_t{weights};
+    } else {
+      throw std::runtime_error{"ERROR: an undefined distribution of " + target + "s is given."};
+    }
+
+    // compute a fingerprint of the parameters
+    fingerprint_ = Mix(Mix(Mix(kFingerprintSeed, dist_.index()), min_), max_);
+    fingerprint_ = Mix(fingerprint_, ToBits(skew));
+    for (const auto &[len, weight] : weights) {
+      fingerprint_ = Mix(Mix(fingerprint_, len), ToBits(weight));
+    }
+  }
+
+  LengthDistribution(const LengthDistribution &) = default;
+  LengthDistribution(LengthDistribution &&) = default;
+
+  auto operator=(const LengthDistribution &) -> LengthDistribution & = default;
+  auto operator=(LengthDistribution &&) -> LengthDistribution & = default;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~LengthDistribution() = default;
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @return the minimum length that can be sampled.
+   */
+  [[nodiscard]] constexpr auto
+  GetMin() const  //
+      -> size_t
+  {
+    return min_;
+  }
+
+  /**
+   * @return the maximum length that can be sampled.
+   */
+  [[nodiscard]] constexpr auto
+  GetMax() const  //
+      -> size_t
+  {
+    return max_;
+  }
+
+  /**
+   * @return a fingerprint of the parameters of this distribution (zero if not given).
+   */
+  [[nodiscard]] constexpr auto
+  GetFingerprint() const  //
+      -> uint64_t
+  {
+    return fingerprint_;
+  }
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @tparam RandEngine a class of random engines.
+   * @param rand_engine a random engine to sample a length.
+   * @return a length drawn from this distribution.
+   */
+  template <class RandEngine>
+  auto
+  operator()(RandEngine &rand_engine) const  //
+      -> size_t
+  {
+    return std::visit(
+        [&](const auto &dist) -> size_t {
+          using D = std::decay_t<decltype(dist)>;
+          if constexpr (std::is_same_v<D, std::monostate>) {
+            return max_;
+          } else if constexpr (std::is_same_v<D, Histogram_t>) {
+            return dist.Sample(std::uniform_real_distribution<double>{0.0, 1.0}(rand_engine));
+          } else {
+            auto copied = dist;  // distributions of a few parameters are cheap to copy
+            return copied(rand_engine);
+          }
+        },
+        dist_);
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// the initial value of fingerprints (the offset basis of FNV-1a).
+  static constexpr uint64_t kFingerprintSeed = 0xCBF29CE484222325UL;
+
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  static constexpr auto
+  Mix(  //
+      const uint64_t hash,
+      const uint64_t val)  //
+      -> uint64_t
+  {
+    return (hash ^ val) * 0x100000001B3UL;  // FNV-1a style mixing
+  }
+
+  static auto
+  ToBits(const double val)  //
+      -> uint64_t
+  {
+    uint64_t bits{};
+    std::memcpy(&bits, &val, sizeof(bits));
+    return bits;
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// the minimum length.
+  size_t min_{0};
+
+  /// the maximum length (i.e., a fixed length if not distributed).
+  size_t max_{0};
+
+  /// a distribution of lengths (empty if the length is fixed).
+  Dist_t dist_{};
+
+  /// a fingerprint of the parameters.
+  uint64_t fingerprint_{0};
+};
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_WORKLOAD_LENGTH_DISTRIBUTION_HPP
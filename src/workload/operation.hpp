@@ -26,21 +26,50 @@ namespace dbgroup
 /**
  * @brief A class to represent index read/write operations.
  *
+ * An operation is packed into one 8-byte word to reduce the memory footprint of
+ * operation-queues: the lower 32 bits hold a key ID, the next bits hold a written
+ * value or a scan length, and the upper four bits hold an operation type. If key
+ * IDs have 64 bits, they are stored in the second word instead of the lower bits.
  */
 template <class Key, class Payload>
-struct Operation {
+class Operation
+{
+ public:
   /*############################################################################
    * Public constructors and assignment operators
    *##########################################################################*/
 
-  Operation(  //
+  constexpr Operation() = default;
+
+  constexpr Operation(  //
       IndexOperation t,
-      uint32_t k,
+      KeyID k,
       uint32_t v)
-      : type{t}, key{k}, value{v}
   {
+    assert(t != kUndefinedOperation);
+    assert(v <= kValueMask);
+
+    data_[0] = (static_cast<uint64_t>(t) << kTypeShift)
+               | ((static_cast<uint64_t>(v) & kValueMask) << kValueShift);
+    if constexpr (kWordNum > 1) {
+      data_[1] = k;
+    } else {
+      data_[0] |= k;
+    }
   }
 
+  constexpr Operation(const Operation &) = default;
+  constexpr Operation(Operation &&) noexcept = default;
+
+  constexpr auto operator=(const Operation &) -> Operation & = default;
+  constexpr auto operator=(Operation &&) noexcept -> Operation & = default;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~Operation() = default;
+
   /*############################################################################
    * Public getters
    *##########################################################################*/
@@ -49,28 +78,73 @@ struct Operation {
   GetOpsID() const  //
       -> size_t
   {
-    return static_cast<size_t>(type);
+    return static_cast<size_t>(data_[0] >> kTypeShift);
   }
 
   [[nodiscard]] constexpr auto
-  GetKey() const  //
-      -> Key
+  GetType() const  //
+      -> IndexOperation
   {
-    return Key{key};
+    return static_cast<IndexOperation>(data_[0] >> kTypeShift);
   }
 
   [[nodiscard]] constexpr auto
-  GetPayload() const  //
-      -> Payload
+  GetKeyID() const  //
+      -> KeyID
   {
-    return Payload{value};
+    if constexpr (kWordNum > 1) {
+      return data_[1];
+    } else {
+      return static_cast<KeyID>(data_[0]);
+    }
   }
 
   [[nodiscard]] constexpr auto
+  GetValue() const  //
+      -> uint32_t
+  {
+    return static_cast<uint32_t>((data_[0] >> kValueShift) & kValueMask);
+  }
+
+  [[nodiscard]] auto
+  GetKey() const  //
+      -> KeyRef_t<Key>
+  {
+    return ToKey<Key>(GetKeyID());
+  }
+
+  /**
+   * @return the exclusive end key of a range scan (i.e., a begin key plus a span).
+   */
+  [[nodiscard]] auto
+  GetEndKey() const  //
+      -> KeyRef_t<Key>
+  {
+    return ToKey<Key>(static_cast<KeyID>(GetKeyID() + GetValue()));
+  }
+
+  [[nodiscard]] auto
+  GetPayload() const  //
+      -> PayloadRef_t<Payload>
+  {
+    return ToPayload<Payload>(GetValue());
+  }
+
+  [[nodiscard]] auto
   GetKeyLength() const  //
       -> size_t
   {
-    return sizeof(Key);
+    return ToKeyLength<Key>(GetKeyID());
+  }
+
+  /**
+   * @return the length of the exclusive end key of a range scan.
+   */
+  [[nodiscard]] auto
+  GetEndKeyLength() const  //
+      -> size_t
+  {
+    return ToKeyLength<Key>(static_cast<KeyID>(GetKeyID() + GetValue()));
   }
 
   [[nodiscard]] constexpr auto
@@ -80,20 +154,35 @@ struct Operation {
     return sizeof(Payload);
   }
 
+ private:
   /*############################################################################
-   * Public member variables
+   * Internal constants
    *##########################################################################*/
 
-  /// a read/write operation to perform
-  IndexOperation type{IndexOperation::kRead};
+  /// the number of words to represent an operation.
+  static constexpr size_t kWordNum = sizeof(KeyID) / sizeof(uint32_t);
+
+  /// the bit position of written values.
+  static constexpr size_t kValueShift = 32;
+
+  /// the bit position of operation types.
+  static constexpr size_t kTypeShift = kValueShift + kOpsValueBitNum;
+
+  /// a bit mask to extract written values.
+  static constexpr uint64_t kValueMask = (1UL << kOpsValueBitNum) - 1UL;
 
-  /// a target key of this operation
-  uint32_t key{};
+  static_assert(kOpsNum <= (1L << (64 - kTypeShift)));
 
-  /// a target data of this operation
-  uint32_t value{};
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// an operation type, a written value, and a target key ID.
+  uint64_t data_[kWordNum]{};
 };
 
+static_assert(sizeof(Operation<uint64_t, uint64_t>) == sizeof(KeyID) / sizeof(uint32_t) * 8);
+
 }  // namespace dbgroup
 
 #endif  // INDEX_BENCHMARK_WORKLOAD_OPERATION_HPP
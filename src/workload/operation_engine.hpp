@@ -18,13 +18,22 @@
 #define INDEX_BENCHMARK_WORKLOAD_OPERATION_ENGINE_HPP
 
 // C++ standard libraries
+#include <algorithm>
 #include <atomic>
 #include <fstream>
+#include <limits>
+#include <memory>
 #include <random>
+#include <string>
 #include <tuple>
+#include <type_traits>
 
 // local sources
+#include "length_distribution.hpp"
 #include "operation.hpp"
+#include "operation_stream.hpp"
+#include "operation_trace.hpp"
+#include "phase_clock.hpp"
 #include "workload.hpp"
 
 namespace dbgroup
@@ -43,6 +52,9 @@ class OperationEngine
 
   using Json_t = ::nlohmann::json;
   using Operation_t = Operation<Key, Payload>;
+  using OperationStream_t = OperationStream<Operation_t>;
+  using TraceWriter_t = OperationTraceWriter<Operation_t>;
+  using TraceReader_t = OperationTraceReader<Operation_t>;
 
  public:
   /*############################################################################
@@ -79,6 +91,41 @@ class OperationEngine
     return {init_key_num_, use_all_cores_for_init_, use_bulkload_if_possible_};
   }
 
+  /**
+   * @return the maximum number of keys in initialization and all the phases.
+   */
+  [[nodiscard]] auto
+  GetMaxKeyNum() const  //
+      -> size_t
+  {
+    auto key_num = init_key_num_;
+    for (const auto &workload : workloads_) {
+      key_num = std::max(key_num, workload.GetKeyNum());
+    }
+    return key_num;
+  }
+
+  /**
+   * @param append_num the maximum number of keys appended by inserts.
+   * @return the maximum key ID that can be used in initialization and all the phases.
+   */
+  [[nodiscard]] auto
+  GetMaxKeyID(const size_t append_num) const  //
+      -> KeyID
+  {
+    constexpr auto kMaxKeyID = std::numeric_limits<KeyID>::max();
+    auto appends = false;
+    for (const auto &workload : workloads_) {
+      if (workload.UsesAbsentKeys()) return kMaxKeyID;
+      appends |= workload.AppendsKeys();
+    }
+
+    // the operations of all the phases append keys at most `append_num` times
+    const auto max_id = static_cast<KeyID>(GetMaxKeyNum() - 1);
+    if (!appends) return max_id;
+    return (append_num > kMaxKeyID - max_id) ? kMaxKeyID : max_id + append_num;
+  }
+
   [[nodiscard]] constexpr auto
   GetOpsTypeNum() const  //
       -> size_t
@@ -86,6 +133,48 @@ class OperationEngine
     return static_cast<size_t>(kOpsNum);
   }
 
+  /**
+   * @retval true if the phases are switched by wall-clock durations.
+   * @retval false if the phases are switched by the number of operations.
+   */
+  [[nodiscard]] auto
+  IsDurationBased() const  //
+      -> bool
+  {
+    return static_cast<bool>(phase_clock_);
+  }
+
+  /**
+   * @return a clock to switch duration-based phases.
+   */
+  [[nodiscard]] auto
+  GetPhaseClock() const  //
+      -> std::shared_ptr<PhaseClock>
+  {
+    return phase_clock_;
+  }
+
+  /**
+   * @return a distribution of the lengths of variable-length keys.
+   */
+  [[nodiscard]] auto
+  GetKeyLengthDistribution() const  //
+      -> const LengthDistribution &
+  {
+    return key_len_dist_;
+  }
+
+  /**
+   * @param phase the index of a phase.
+   * @return the names of thread groups in the phase (empty if not grouped).
+   */
+  [[nodiscard]] auto
+  GetThreadGroupNames(const size_t phase) const  //
+      -> const std::vector<std::string> &
+  {
+    return workloads_.at(phase).GetThreadGroupNames();
+  }
+
   /*############################################################################
    * Public utilities
    *##########################################################################*/
@@ -98,30 +187,95 @@ class OperationEngine
     init_key_num_ = init_json.at("# of keys");
     use_all_cores_for_init_ = init_json.value("use all cores", true);
     use_bulkload_if_possible_ = init_json.value("use bulkload if possible", true);
+    if (init_json.contains("key length")) {
+      key_len_dist_ = LengthDistribution{init_json.at("key length"), "key length"};
+    } else if constexpr (IsVarLenKey<Key>()) {
+      throw std::runtime_error{"ERROR: variable-length keys require \"key length\"."};
+    }
 
     // set workloads
     workloads_.clear();
     const auto &workloads_json = json.at("workloads");
     double cum_val = 0;
+    std::vector<double> durations{};
     for (const auto &w_json : workloads_json) {
       workloads_.emplace_back(w_json);
       cum_val += workloads_.back().GetExecutionRatio();
+      if (workloads_.back().GetDuration() > 0) {
+        durations.emplace_back(workloads_.back().GetDuration());
+      }
     }
 
-    if (!AlmostEqual(cum_val, 1.0)) {
+    // duration-based phases ignore execution ratios
+    phase_clock_.reset();
+    if (!durations.empty()) {
+      if (durations.size() != workloads_.size()) {
+        throw std::runtime_error{"ERROR: all the phases must have durations if any has one."};
+      }
+      phase_clock_ = std::make_shared<PhaseClock>(durations);
+    } else if (!AlmostEqual(cum_val, 1.0)) {
       throw std::runtime_error{"ERROR: the total execution ratios is not one."};
     }
   }
 
+  /**
+   * @brief Generate operations chunk by chunk during benchmarking.
+   *
+   * This mode bounds memory usage regardless of the number of operations, but
+   * the cost of generation is included in measured regions.
+   */
+  void
+  StreamOperations()
+  {
+    stream_ops_ = true;
+  }
+
+  /**
+   * @brief Dump generated operation-queues into a given trace file.
+   *
+   * @param path the path to a trace file to be created.
+   */
+  void
+  RecordTrace(const std::string &path)
+  {
+    if (trace_reader_) {
+      throw std::runtime_error{"ERROR: a trace cannot be recorded while replaying a trace."};
+    }
+    trace_writer_ = std::make_shared<TraceWriter_t>(path, GetTraceSettings());
+  }
+
+  /**
+   * @brief Replay operation-queues in a given trace file instead of generation.
+   *
+   * @param path the path to a trace file recorded by `RecordTrace`.
+   */
+  void
+  ReplayTrace(const std::string &path)
+  {
+    if (trace_writer_) {
+      throw std::runtime_error{"ERROR: a trace cannot be replayed while recording a trace."};
+    }
+    trace_reader_ = std::make_shared<TraceReader_t>(path, GetTraceSettings());
+  }
+
   auto
   Generate(  //
       const size_t total_num,
       const size_t random_seed)  //
       -> std::vector<Operation_t>
   {
+    if (phase_clock_) {
+      throw std::runtime_error{"ERROR: duration-based phases cannot be materialized."};
+    }
+
     const auto worker_id = worker_count_.fetch_add(1);
+    if (trace_reader_) {
+      const auto *ops = trace_reader_->GetOperations(worker_id, total_num);
+      return std::vector<Operation_t>(ops, ops + total_num);
+    }
+
     const auto phase_num = workloads_.size();
-    std::mt19937_64 rand_engine{random_seed};
+    RandEngine_t rand_engine{random_seed};
 
     // generate an operation-queue for benchmarking
     std::vector<Operation_t> operations{};
@@ -137,10 +291,127 @@ class OperationEngine
       exec_num += n;
     }
 
+    if (trace_writer_) {
+      trace_writer_->Write(worker_id, worker_num_, operations.data(), total_num);
+    }
+
     return operations;
   }
 
+  /**
+   * @brief Create an operation-queue that yields operations chunk by chunk.
+   *
+   * The returned stream yields the same operations as `Generate` with the same
+   * random seed. By default, all the chunks are generated in advance so that
+   * generation is not measured. If `StreamOperations` is called, the stream
+   * generates each chunk on the fly and retains only one at once. If a trace
+   * file is replayed, the stream reads the mapped operations directly. If a trace
+   * is recorded, the operations are materialized once to be dumped. If the
+   * phases are duration-based, `total_num` is ignored (see `GenerateTimedStream`).
+   *
+   * @param total_num the number of operations for a worker.
+   * @param random_seed a random seed for a worker.
+   * @return a stream of operations.
+   */
+  auto
+  GenerateStream(  //
+      const size_t total_num,
+      const size_t random_seed)  //
+      -> OperationStream_t
+  {
+    if (phase_clock_) return GenerateTimedStream(random_seed);
+    if (trace_writer_) return OperationStream_t{Generate(total_num, random_seed)};
+
+    const auto worker_id = worker_count_.fetch_add(1);
+    if (trace_reader_) {
+      return OperationStream_t{trace_reader_->GetOperations(worker_id, total_num), total_num};
+    }
+
+    const auto phase_num = workloads_.size();
+    RandEngine_t rand_engine{random_seed};
+
+    // prepare generators for each phase
+    std::vector<std::pair<Workload::Generator, size_t>> phases{};
+    phases.reserve(phase_num);
+    size_t exec_num = 0;
+    for (size_t i = 0; i < phase_num; ++i) {
+      const auto &phase = workloads_.at(i);
+      const auto exec_ratio = phase.GetExecutionRatio();
+      const size_t n = (i == phase_num - 1) ? total_num - exec_num : total_num * exec_ratio;
+
+      phases.emplace_back(phase.GetGenerator(worker_id, worker_num_, rand_engine()), n);
+
+      exec_num += n;
+    }
+
+    OperationStream_t stream{std::move(phases)};
+    if (!stream_ops_) {
+      stream.Prepare();
+    }
+    return stream;
+  }
+
+  /**
+   * @brief Create an operation stream for duration-based phases.
+   *
+   * The returned stream switches phases when the shared phase clock passes each
+   * deadline, and it ends after the last phase.
+   *
+   * @param random_seed a random seed for a worker.
+   * @return a stream of operations.
+   */
+  auto
+  GenerateTimedStream(const size_t random_seed)  //
+      -> OperationStream_t
+  {
+    if (!phase_clock_) {
+      throw std::runtime_error{"ERROR: the phases do not have durations."};
+    }
+    if (trace_reader_ || trace_writer_) {
+      throw std::runtime_error{"ERROR: duration-based phases cannot be recorded or replayed."};
+    }
+
+    const auto worker_id = worker_count_.fetch_add(1);
+    RandEngine_t rand_engine{random_seed};
+
+    std::vector<Workload::Generator> generators{};
+    generators.reserve(workloads_.size());
+    for (const auto &phase : workloads_) {
+      generators.emplace_back(phase.GetGenerator(worker_id, worker_num_, rand_engine()));
+    }
+
+    return OperationStream_t{std::move(generators), phase_clock_};
+  }
+
  private:
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  /**
+   * @return a trace header holding the settings that map key IDs and written
+   * values to actual keys and payloads.
+   */
+  [[nodiscard]] auto
+  GetTraceSettings() const  //
+      -> TraceHeader
+  {
+    TraceHeader settings{};
+    if constexpr (IsVarLenKey<Key>()) {
+      settings.key_kind = kVarLenKey;
+      settings.key_length_fingerprint = key_len_dist_.GetFingerprint();
+    } else if constexpr (std::is_class_v<Key>) {
+      settings.key_kind = kFixedLenKey;
+    }
+    settings.key_size = sizeof(Key);
+    settings.payload_size = sizeof(Payload);
+    if (const auto *dataset = KeyDataset::Get(); dataset != nullptr) {
+      settings.dataset_key_num = dataset->GetKeyNum();
+      settings.dataset_fingerprint = dataset->GetFingerprint();
+    }
+    return settings;
+  }
+
   /*############################################################################
    * Internal member variables
    *##########################################################################*/
@@ -155,7 +426,22 @@ class OperationEngine
 
   size_t worker_num_{1};
 
+  /// a distribution of the lengths of variable-length keys.
+  LengthDistribution key_len_dist_{};
+
   std::vector<Workload> workloads_{Workload{}};
+
+  /// a flag for generating operations during benchmarking.
+  bool stream_ops_{false};
+
+  /// a writer to record generated operations if required.
+  std::shared_ptr<TraceWriter_t> trace_writer_{nullptr};
+
+  /// a reader to replay recorded operations if required.
+  std::shared_ptr<TraceReader_t> trace_reader_{nullptr};
+
+  /// a clock to switch duration-based phases if required.
+  std::shared_ptr<PhaseClock> phase_clock_{nullptr};
 };
 
 }  // namespace dbgroup
@@ -0,0 +1,460 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_WORKLOAD_OPERATION_STREAM_HPP
+#define INDEX_BENCHMARK_WORKLOAD_OPERATION_STREAM_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// local sources
+#include "phase_clock.hpp"
+#include "workload.hpp"
+
+namespace dbgroup
+{
+
+/**
+ * @brief A class for generating an operation-queue lazily.
+ *
+ * This class retains only a fixed-size chunk of operations and refills it when
+ * a worker consumes all of them. The produced sequence is the same as the one
+ * materialized by `OperationEngine::Generate` with the same random seed. This
+ * class can also wrap an existing operation-queue (e.g., a memory-mapped trace
+ * file) to feed workers without generation. If phases are duration-based, this
+ * class switches generators according to a shared clock and never ends until
+ * the last phase finishes. A chunk never spans multiple phases, and it is
+ * extended to include the rest of a batch of multi reads. A count-based stream
+ * can also generate all of its chunks in advance (see `Prepare`) to exclude the
+ * cost of generation from measured regions.
+ *
+ * @tparam Operation a class to represent index read/write operations.
+ */
+template <class Operation>
+class OperationStream
+{
+  /*############################################################################
+   * Type aliases
+   *##########################################################################*/
+
+  using Generator_t = Workload::Generator;
+
+ public:
+  /*############################################################################
+   * Public inner classes
+   *##########################################################################*/
+
+  /**
+   * @brief An input iterator to consume generated operations.
+   *
+   */
+  class Iterator
+  {
+   public:
+    /*##########################################################################
+     * Type aliases for iterator traits
+     *########################################################################*/
+
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Operation;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Operation *;
+    using reference = const Operation &;
+
+    /*##########################################################################
+     * Public constructors and assignment operators
+     *########################################################################*/
+
+    constexpr Iterator() = default;
+
+    explicit constexpr Iterator(OperationStream *stream) : stream_{stream} {}
+
+    /*##########################################################################
+     * Public operators for iterators
+     *########################################################################*/
+
+    auto
+    operator*() const  //
+        -> reference
+    {
+      return stream_->ops_[stream_->pos_];
+    }
+
+    auto
+    operator->() const  //
+        -> pointer
+    {
+      return &(stream_->ops_[stream_->pos_]);
+    }
+
+    auto
+    operator++()  //
+        -> Iterator &
+    {
+      stream_->Forward();
+      return *this;
+    }
+
+    auto
+    operator==(const Iterator &obj) const  //
+        -> bool
+    {
+      return IsEnd() == obj.IsEnd();
+    }
+
+    auto
+    operator!=(const Iterator &obj) const  //
+        -> bool
+    {
+      return IsEnd() != obj.IsEnd();
+    }
+
+   private:
+    /*##########################################################################
+     * Internal utilities
+     *########################################################################*/
+
+    [[nodiscard]] auto
+    IsEnd() const  //
+        -> bool
+    {
+      return stream_ == nullptr || stream_->IsEnd();
+    }
+
+    /*##########################################################################
+     * Internal member variables
+     *########################################################################*/
+
+    /// a stream to be consumed.
+    OperationStream *stream_{nullptr};
+  };
+
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param phases pairs of generators and the number of operations per phase.
+   */
+  explicit OperationStream(std::vector<std::pair<Generator_t, size_t>> &&phases)
+      : phases_{std::move(phases)}
+  {
+    for (const auto &[gen, n] : phases_) {
+      total_num_ += n;
+    }
+    chunk_.reserve(kChunkSize);
+    Refill();
+  }
+
+  /**
+   * @param generators generators for each duration-based phase.
+   * @param clock a clock shared by all the workers to switch phases.
+   */
+  OperationStream(  //
+      std::vector<Generator_t> &&generators,
+      std::shared_ptr<const PhaseClock> clock)
+      : total_num_{std::numeric_limits<size_t>::max()}, clock_{std::move(clock)}
+  {
+    phases_.reserve(generators.size());
+    for (auto &&gen : generators) {
+      phases_.emplace_back(std::move(gen), 0);
+    }
+    chunk_.reserve(kTimedChunkSize);
+    Refill();
+  }
+
+  /**
+   * @param ops a materialized operation-queue to be retained by this stream.
+   */
+  explicit OperationStream(std::vector<Operation> &&ops)
+      : total_num_{ops.size()}, chunk_{std::move(ops)}
+  {
+    ops_ = chunk_.data();
+    ops_num_ = chunk_.size();
+  }
+
+  /**
+   * @param ops the head of an existing operation-queue.
+   * @param ops_num the number of operations in the queue.
+   */
+  OperationStream(  //
+      const Operation *ops,
+      const size_t ops_num)
+      : total_num_{ops_num}, ops_{ops}, ops_num_{ops_num}
+  {
+  }
+
+  OperationStream(const OperationStream &) = delete;
+  OperationStream(OperationStream &&) noexcept = default;
+
+  auto operator=(const OperationStream &) -> OperationStream & = delete;
+  auto operator=(OperationStream &&) noexcept -> OperationStream & = default;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~OperationStream() = default;
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @return the total number of operations in this stream.
+   */
+  [[nodiscard]] constexpr auto
+  size() const  //
+      -> size_t
+  {
+    return total_num_;
+  }
+
+  /**
+   * @return the index of the phase that the current operation belongs to.
+   * @note This value is only valid for generated operations.
+   */
+  [[nodiscard]] constexpr auto
+  GetPhase() const  //
+      -> size_t
+  {
+    return phase_;
+  }
+
+  /**
+   * @return the thread group of this worker in the current phase.
+   * @note This value is only valid for generated operations.
+   */
+  [[nodiscard]] auto
+  GetGroup() const  //
+      -> size_t
+  {
+    return (phase_ < phases_.size()) ? phases_[phase_].first.GetGroupID() : 0;
+  }
+
+  /**
+   * @return the only operation type in the current phase (`kUndefinedOperation`
+   * if mixed or unknown, e.g., for replayed operations).
+   */
+  [[nodiscard]] auto
+  GetSingleOperation() const  //
+      -> IndexOperation
+  {
+    return (phase_ < phases_.size()) ? phases_[phase_].first.GetSingleOperation()
+                                     : kUndefinedOperation;
+  }
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Generate all the remaining chunks in advance.
+   *
+   * The prepared chunks are consumed in the same order with the same phases, so
+   * only the timing of generation changes. This function does nothing for
+   * duration-based phases and wrapped operation-queues.
+   */
+  void
+  Prepare()
+  {
+    if (clock_ || phases_.empty() || is_prepared_) return;
+
+    while (!IsEnd()) {
+      prepared_.emplace_back(phase_, std::move(chunk_));
+      chunk_ = std::vector<Operation>{};
+      chunk_.reserve(kChunkSize);
+      Refill();
+    }
+    is_prepared_ = true;
+    Refill();
+  }
+
+  /**
+   * @brief Consume the remaining operations chunk by chunk.
+   *
+   * The getters of this stream (e.g., `GetPhase`) describe the chunk passed to
+   * a given function, and all the operations in a chunk belong to the same
+   * phase. If the function returns a boolean, `false` stops consumption.
+   *
+   * @param f a function that receives the head of a chunk and its size.
+   */
+  template <class Func>
+  void
+  ForEachChunk(Func &&f)
+  {
+    using Ret_t = std::invoke_result_t<Func, const Operation *, size_t>;
+
+    while (!IsEnd()) {
+      if constexpr (std::is_same_v<Ret_t, bool>) {
+        if (!f(&(ops_[pos_]), ops_num_ - pos_)) return;
+      } else {
+        f(&(ops_[pos_]), ops_num_ - pos_);
+      }
+      Refill();
+    }
+  }
+
+  /**
+   * @return an iterator pointing to the current operation.
+   * @note Since this stream is consumed only once, all the iterators share the
+   * current position.
+   */
+  auto
+  begin()  //
+      -> Iterator
+  {
+    return Iterator{this};
+  }
+
+  /**
+   * @return an iterator representing the end of this stream.
+   */
+  constexpr auto
+  end()  //
+      -> Iterator
+  {
+    return Iterator{};
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// the number of operations generated at once.
+  static constexpr size_t kChunkSize = 4096;
+
+  /// the number of operations generated at once for duration-based phases.
+  static constexpr size_t kTimedChunkSize = 256;
+
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  [[nodiscard]] auto
+  IsEnd() const  //
+      -> bool
+  {
+    return pos_ >= ops_num_;
+  }
+
+  void
+  Forward()
+  {
+    if (++pos_ < ops_num_) return;
+    Refill();
+  }
+
+  /**
+   * @brief Overwrite the current chunk with the following operations.
+   *
+   */
+  void
+  Refill()
+  {
+    chunk_.clear();
+    pos_ = 0;
+    ops_num_ = 0;
+    if (is_prepared_) {
+      // take over the next chunk generated in advance
+      if (next_chunk_ < prepared_.size()) {
+        auto &[phase, chunk] = prepared_[next_chunk_++];
+        phase_ = phase;
+        chunk_ = std::move(chunk);
+      }
+      ops_ = chunk_.data();
+      ops_num_ = chunk_.size();
+      return;
+    }
+    if (clock_) {
+      // follow the shared clock instead of the number of operations
+      phase_ = clock_->GetPhase();
+      if (phase_ < phases_.size()) {
+        auto &gen = phases_[phase_].first;
+        for (size_t i = 0; i < kTimedChunkSize || gen.IsInBatch(); ++i) {
+          chunk_.emplace_back(gen.template Next<Operation>());
+        }
+      }
+      ops_ = chunk_.data();
+      ops_num_ = chunk_.size();
+      return;
+    }
+
+    // skip finished phases so that a chunk belongs to one phase
+    while (phase_ < phases_.size() && phases_[phase_].second == 0) {
+      ++phase_;
+    }
+    if (phase_ < phases_.size()) {
+      auto &[gen, remain] = phases_[phase_];
+      size_t n = 0;
+      for (; n < remain && (n < kChunkSize || gen.IsInBatch()); ++n) {
+        chunk_.emplace_back(gen.template Next<Operation>());
+      }
+      remain -= n;
+    }
+    ops_ = chunk_.data();
+    ops_num_ = chunk_.size();
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// generators and the number of remaining operations for each phase.
+  std::vector<std::pair<Generator_t, size_t>> phases_{};
+
+  /// the total number of operations in this stream.
+  size_t total_num_{0};
+
+  /// the index of a current phase.
+  size_t phase_{0};
+
+  /// the position of a current operation in a chunk.
+  size_t pos_{0};
+
+  /// the head of operations to be consumed.
+  const Operation *ops_{nullptr};
+
+  /// the number of operations to be consumed.
+  size_t ops_num_{0};
+
+  /// a buffer for generated operations.
+  std::vector<Operation> chunk_{};
+
+  /// a clock to switch duration-based phases if required.
+  std::shared_ptr<const PhaseClock> clock_{nullptr};
+
+  /// pairs of a phase and a chunk generated in advance.
+  std::vector<std::pair<size_t, std::vector<Operation>>> prepared_{};
+
+  /// the position of the next prepared chunk.
+  size_t next_chunk_{0};
+
+  /// a flag for consuming prepared chunks instead of generating ones.
+  bool is_prepared_{false};
+};
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_WORKLOAD_OPERATION_STREAM_HPP
@@ -0,0 +1,356 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_WORKLOAD_OPERATION_TRACE_HPP
+#define INDEX_BENCHMARK_WORKLOAD_OPERATION_TRACE_HPP
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// system libraries
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup
+{
+
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+/// a magic number to identify trace files ("IDXTRACE" in little endian).
+constexpr uint64_t kTraceMagic = 0x4543415254584449UL;
+
+/// the version of the trace format.
+constexpr uint32_t kTraceVersion = 3;
+
+/**
+ * @brief A list of the kinds of keys that key IDs in trace files refer to.
+ *
+ */
+enum TraceKeyKind : uint32_t {
+  kIntegerKey = 0,
+  kFixedLenKey,
+  kVarLenKey,
+};
+
+/**
+ * @brief The header of trace files.
+ *
+ * A trace file consists of this header and the operation-queues of all the
+ * workers. Each queue has the same number of operations, and the queue of the
+ * i-th worker begins at `sizeof(TraceHeader) + i * ops_num * ops_size`. Since
+ * operations only hold key IDs and written values, the header also records the
+ * settings that map them to actual keys and payloads.
+ */
+struct TraceHeader {
+  /// a magic number to identify trace files.
+  uint64_t magic{kTraceMagic};
+
+  /// the version of the trace format.
+  uint32_t version{kTraceVersion};
+
+  /// the size of each operation in bytes.
+  uint32_t ops_size{0};
+
+  /// the number of recorded workers.
+  uint64_t worker_num{0};
+
+  /// the number of operations per worker.
+  uint64_t ops_num{0};
+
+  /// the kind of target keys.
+  uint32_t key_kind{kIntegerKey};
+
+  /// the size of each key in bytes.
+  uint32_t key_size{0};
+
+  /// the size of each payload in bytes.
+  uint64_t payload_size{0};
+
+  /// the number of keys in a loaded dataset (zero if keys are built from IDs).
+  uint64_t dataset_key_num{0};
+
+  /// the fingerprint of a loaded dataset (zero if keys are built from IDs).
+  uint64_t dataset_fingerprint{0};
+
+  /// the fingerprint of the distribution of key lengths (zero if keys are not variable-length).
+  uint64_t key_length_fingerprint{0};
+};
+
+/*##############################################################################
+ * Class definitions
+ *############################################################################*/
+
+/**
+ * @brief A class for dumping generated operation-queues into a trace file.
+ *
+ * @tparam Operation a class to represent index read/write operations.
+ */
+template <class Operation>
+class OperationTraceWriter
+{
+  static_assert(std::is_trivially_copyable_v<Operation>);
+
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param path the path to a trace file to be created.
+   * @param settings a header holding the settings of this benchmark.
+   */
+  OperationTraceWriter(  //
+      const std::string &path,
+      const TraceHeader &settings)
+      : header_{settings}
+  {
+    fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd_ < 0) {
+      throw std::runtime_error{"ERROR: the trace file (" + path + ") cannot be created."};
+    }
+  }
+
+  OperationTraceWriter(const OperationTraceWriter &) = delete;
+  OperationTraceWriter(OperationTraceWriter &&) = delete;
+
+  auto operator=(const OperationTraceWriter &) -> OperationTraceWriter & = delete;
+  auto operator=(OperationTraceWriter &&) -> OperationTraceWriter & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~OperationTraceWriter() { ::close(fd_); }
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Write the operation-queue of a worker into its region.
+   *
+   * Workers can call this function concurrently, but all of them must pass
+   * operation-queues with the same length.
+   *
+   * @param worker_id the ID of a worker thread.
+   * @param worker_num the total number of worker threads.
+   * @param ops the head of an operation-queue.
+   * @param ops_num the number of operations in the queue.
+   */
+  void
+  Write(  //
+      const size_t worker_id,
+      const size_t worker_num,
+      const Operation *ops,
+      const size_t ops_num)
+  {
+    auto header = header_;
+    header.ops_size = sizeof(Operation);
+    header.worker_num = worker_num;
+    header.ops_num = ops_num;
+    const size_t queue_size = ops_num * sizeof(Operation);
+    PWrite(&header, sizeof(TraceHeader), 0);
+    PWrite(ops, queue_size, sizeof(TraceHeader) + worker_id * queue_size);
+  }
+
+ private:
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  void
+  PWrite(  //
+      const void *buf,
+      const size_t size,
+      size_t offset) const
+  {
+    const auto *ptr = reinterpret_cast<const char *>(buf);
+    for (size_t written = 0; written < size;) {
+      const auto rc = ::pwrite(fd_, ptr + written, size - written, offset + written);
+      if (rc < 0) throw std::runtime_error{"ERROR: failed to write a trace file."};
+      written += rc;
+    }
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// the settings of this benchmark.
+  TraceHeader header_{};
+
+  /// a file descriptor of a trace file.
+  int fd_{-1};
+};
+
+/**
+ * @brief A class for replaying operation-queues from a memory-mapped trace file.
+ *
+ * @tparam Operation a class to represent index read/write operations.
+ */
+template <class Operation>
+class OperationTraceReader
+{
+  static_assert(std::is_trivially_copyable_v<Operation>);
+
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param path the path to a recorded trace file.
+   * @param settings a header holding the settings of this benchmark.
+   */
+  OperationTraceReader(  //
+      const std::string &path,
+      const TraceHeader &settings)
+  {
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error{"ERROR: the trace file (" + path + ") cannot be opened."};
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(TraceHeader)) {
+      ::close(fd);
+      throw std::runtime_error{"ERROR: the trace file (" + path + ") is too short."};
+    }
+    file_size_ = st.st_size;
+
+    addr_ = ::mmap(nullptr, file_size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr_ == MAP_FAILED) {
+      addr_ = nullptr;
+      throw std::runtime_error{"ERROR: the trace file (" + path + ") cannot be mapped."};
+    }
+
+    // check the given file is a valid trace for this build
+    const auto *header = reinterpret_cast<const TraceHeader *>(addr_);
+    const auto expected_size
+        = sizeof(TraceHeader) + header->worker_num * header->ops_num * sizeof(Operation);
+    if (header->magic != kTraceMagic || header->version != kTraceVersion
+        || header->ops_size != sizeof(Operation) || file_size_ < expected_size) {
+      Unmap();
+      throw std::runtime_error{"ERROR: the trace file (" + path + ") is not compatible."};
+    }
+    if (header->key_kind != settings.key_kind || header->key_size != settings.key_size) {
+      Unmap();
+      throw std::runtime_error{"ERROR: the trace file (" + path + ") has another key type."};
+    }
+    if (header->payload_size != settings.payload_size) {
+      Unmap();
+      throw std::runtime_error{"ERROR: the trace file (" + path + ") has another payload size."};
+    }
+    if (header->dataset_key_num != settings.dataset_key_num
+        || header->dataset_fingerprint != settings.dataset_fingerprint) {
+      Unmap();
+      throw std::runtime_error{"ERROR: the trace file (" + path + ") used another dataset."};
+    }
+    if (header->key_length_fingerprint != settings.key_length_fingerprint) {
+      Unmap();
+      throw std::runtime_error{"ERROR: the trace file (" + path
+                               + ") used another distribution of key lengths."};
+    }
+    worker_num_ = header->worker_num;
+    ops_num_ = header->ops_num;
+    ::madvise(addr_, file_size_, MADV_SEQUENTIAL);
+  }
+
+  OperationTraceReader(const OperationTraceReader &) = delete;
+  OperationTraceReader(OperationTraceReader &&) = delete;
+
+  auto operator=(const OperationTraceReader &) -> OperationTraceReader & = delete;
+  auto operator=(OperationTraceReader &&) -> OperationTraceReader & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~OperationTraceReader() { Unmap(); }
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @param worker_id the ID of a worker thread.
+   * @param ops_num the number of operations to be replayed.
+   * @return the head of the recorded operation-queue of the given worker.
+   */
+  [[nodiscard]] auto
+  GetOperations(  //
+      const size_t worker_id,
+      const size_t ops_num) const  //
+      -> const Operation *
+  {
+    if (worker_id >= worker_num_) {
+      throw std::runtime_error{"ERROR: the trace file has fewer workers than required."};
+    }
+    if (ops_num > ops_num_) {
+      throw std::runtime_error{"ERROR: the trace file has fewer operations than required."};
+    }
+
+    const auto *head = reinterpret_cast<const std::byte *>(addr_) + sizeof(TraceHeader);
+    return reinterpret_cast<const Operation *>(head) + worker_id * ops_num_;
+  }
+
+ private:
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  void
+  Unmap()
+  {
+    if (addr_ != nullptr) {
+      ::munmap(addr_, file_size_);
+      addr_ = nullptr;
+    }
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// the head address of a mapped file.
+  void *addr_{nullptr};
+
+  /// the size of a mapped file.
+  size_t file_size_{0};
+
+  /// the number of recorded workers.
+  size_t worker_num_{0};
+
+  /// the number of operations per worker.
+  size_t ops_num_{0};
+};
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_WORKLOAD_OPERATION_TRACE_HPP
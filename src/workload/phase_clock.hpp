@@ -0,0 +1,165 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_WORKLOAD_PHASE_CLOCK_HPP
+#define INDEX_BENCHMARK_WORKLOAD_PHASE_CLOCK_HPP
+
+// C++ standard libraries
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dbgroup
+{
+
+/**
+ * @brief A class for switching duration-based phases at shared deadlines.
+ *
+ * All the workers refer to the same instance, so they move to the next phase at
+ * the same wall-clock time. Before `Start` is called, the first phase is kept.
+ */
+class PhaseClock
+{
+  /*############################################################################
+   * Type aliases
+   *##########################################################################*/
+
+  using Clock_t = std::chrono::steady_clock;
+
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param durations the duration of each phase in seconds.
+   */
+  explicit PhaseClock(const std::vector<double> &durations) : durations_{durations}
+  {
+    int64_t deadline = 0;
+    for (const auto sec : durations_) {
+      deadline += static_cast<int64_t>(sec * 1e9);
+      deadlines_.emplace_back(deadline);
+    }
+  }
+
+  PhaseClock(const PhaseClock &) = delete;
+  PhaseClock(PhaseClock &&) = delete;
+
+  auto operator=(const PhaseClock &) -> PhaseClock & = delete;
+  auto operator=(PhaseClock &&) -> PhaseClock & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~PhaseClock() = default;
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @return the number of phases.
+   */
+  [[nodiscard]] auto
+  GetPhaseNum() const  //
+      -> size_t
+  {
+    return deadlines_.size();
+  }
+
+  /**
+   * @param phase the index of a phase.
+   * @return the duration of the phase in seconds.
+   */
+  [[nodiscard]] auto
+  GetDuration(const size_t phase) const  //
+      -> double
+  {
+    return durations_.at(phase);
+  }
+
+  /**
+   * @return the index of the current phase (the number of phases if finished).
+   */
+  [[nodiscard]] auto
+  GetPhase() const  //
+      -> size_t
+  {
+    const auto start = start_.load(std::memory_order_acquire);
+    if (start == kNotStarted) return 0;
+
+    const auto elapsed = Now() - start;
+    size_t phase = 0;
+    while (phase < deadlines_.size() && elapsed >= deadlines_[phase]) {
+      ++phase;
+    }
+    return phase;
+  }
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Start the first phase.
+   *
+   */
+  void
+  Start()
+  {
+    start_.store(Now(), std::memory_order_release);
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// a dummy start time for clocks that have not started.
+  static constexpr int64_t kNotStarted = -1;
+
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  static auto
+  Now()  //
+      -> int64_t
+  {
+    return std::chrono::nanoseconds{Clock_t::now().time_since_epoch()}.count();
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// the duration of each phase in seconds.
+  std::vector<double> durations_{};
+
+  /// the deadline of each phase in nanoseconds from the start.
+  std::vector<int64_t> deadlines_{};
+
+  /// the start time in nanoseconds.
+  std::atomic<int64_t> start_{kNotStarted};
+};
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_WORKLOAD_PHASE_CLOCK_HPP
@@ -0,0 +1,319 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_WORKLOAD_RAND_ENGINE_HPP
+#define INDEX_BENCHMARK_WORKLOAD_RAND_ENGINE_HPP
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace dbgroup
+{
+
+/*##############################################################################
+ * Global utilities
+ *############################################################################*/
+
+/**
+ * @brief Compute the next value of SplitMix64 to expand a random seed.
+ *
+ * @param state the state of SplitMix64 to be updated.
+ * @return a random value.
+ */
+constexpr auto
+SplitMix64(uint64_t &state)  //
+    -> uint64_t
+{
+  auto x = (state += 0x9E3779B97F4A7C15UL);
+  x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9UL;
+  x = (x ^ (x >> 27U)) * 0x94D049BB133111EBUL;
+  return x ^ (x >> 31U);
+}
+
+/*##############################################################################
+ * Class definitions
+ *############################################################################*/
+
+/**
+ * @brief A random engine that runs independent xoshiro256++ generators in lanes.
+ *
+ * Each call of `Fill` advances all the lanes at once. Since the lanes share no
+ * data dependency, a compiler can map the update of each state word to one SIMD
+ * instruction (e.g., AVX2 for four 64-bit lanes).
+ */
+class Xoshiro256PlusPlus
+{
+ public:
+  /*############################################################################
+   * Type aliases and constants for UniformRandomBitGenerator
+   *##########################################################################*/
+
+  using result_type = uint64_t;
+
+  /// the number of values generated at once.
+  static constexpr size_t kLaneNum = 4;
+
+  static constexpr auto
+  min()  //
+      -> result_type
+  {
+    return 0;
+  }
+
+  static constexpr auto
+  max()  //
+      -> result_type
+  {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  constexpr Xoshiro256PlusPlus() : Xoshiro256PlusPlus{0} {}
+
+  explicit constexpr Xoshiro256PlusPlus(uint64_t seed)
+  {
+    for (size_t i = 0; i < kStateNum; ++i) {
+      for (size_t j = 0; j < kLaneNum; ++j) {
+        state_[i][j] = SplitMix64(seed);
+      }
+    }
+  }
+
+  constexpr Xoshiro256PlusPlus(const Xoshiro256PlusPlus &) = default;
+  constexpr Xoshiro256PlusPlus(Xoshiro256PlusPlus &&) = default;
+
+  constexpr auto operator=(const Xoshiro256PlusPlus &) -> Xoshiro256PlusPlus & = default;
+  constexpr auto operator=(Xoshiro256PlusPlus &&) -> Xoshiro256PlusPlus & = default;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~Xoshiro256PlusPlus() = default;
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @return a random value.
+   */
+  constexpr auto
+  operator()()  //
+      -> result_type
+  {
+    if (pos_ >= kLaneNum) {
+      Fill(buf_);
+      pos_ = 0;
+    }
+    return buf_[pos_++];
+  }
+
+  /**
+   * @brief Generate `kLaneNum` random values at once.
+   *
+   * @param out an array to write generated values.
+   */
+  constexpr void
+  Fill(result_type out[kLaneNum])
+  {
+    auto &[s0, s1, s2, s3] = state_;
+    for (size_t j = 0; j < kLaneNum; ++j) {
+      out[j] = RotL(s0[j] + s3[j], 23) + s0[j];
+    }
+    for (size_t j = 0; j < kLaneNum; ++j) {
+      const auto t = s1[j] << 17U;
+      s2[j] ^= s0[j];
+      s3[j] ^= s1[j];
+      s1[j] ^= s2[j];
+      s0[j] ^= s3[j];
+      s2[j] ^= t;
+      s3[j] = RotL(s3[j], 45);
+    }
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// the number of state words of xoshiro256++.
+  static constexpr size_t kStateNum = 4;
+
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  static constexpr auto
+  RotL(  //
+      const uint64_t x,
+      const int k)  //
+      -> uint64_t
+  {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// the state words of all the lanes (word-major for SIMD).
+  uint64_t state_[kStateNum][kLaneNum]{};
+
+  /// generated values that have not been returned yet.
+  result_type buf_[kLaneNum]{};
+
+  /// the position of the next value in the buffer.
+  size_t pos_{kLaneNum};
+};
+
+/**
+ * @brief A counter-based random engine (wyrand).
+ *
+ * Since the i-th value depends only on the seed and i, `Fill` computes a batch
+ * of values without any loop-carried dependency except for the counter.
+ */
+class WyRand
+{
+ public:
+  /*############################################################################
+   * Type aliases and constants for UniformRandomBitGenerator
+   *##########################################################################*/
+
+  using result_type = uint64_t;
+
+  /// the number of values generated at once.
+  static constexpr size_t kLaneNum = 8;
+
+  static constexpr auto
+  min()  //
+      -> result_type
+  {
+    return 0;
+  }
+
+  static constexpr auto
+  max()  //
+      -> result_type
+  {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  constexpr WyRand() = default;
+
+  explicit constexpr WyRand(uint64_t seed) : state_{SplitMix64(seed)} {}
+
+  constexpr WyRand(const WyRand &) = default;
+  constexpr WyRand(WyRand &&) = default;
+
+  constexpr auto operator=(const WyRand &) -> WyRand & = default;
+  constexpr auto operator=(WyRand &&) -> WyRand & = default;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~WyRand() = default;
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @return a random value.
+   */
+  constexpr auto
+  operator()()  //
+      -> result_type
+  {
+    state_ += kIncrement;
+    return Mum(state_, state_ ^ kMixer);
+  }
+
+  /**
+   * @brief Generate `kLaneNum` random values at once.
+   *
+   * @param out an array to write generated values.
+   */
+  constexpr void
+  Fill(result_type out[kLaneNum])
+  {
+    for (size_t j = 0; j < kLaneNum; ++j) {
+      const auto s = state_ + (j + 1) * kIncrement;
+      out[j] = Mum(s, s ^ kMixer);
+    }
+    state_ += kLaneNum * kIncrement;
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  static constexpr uint64_t kIncrement = 0xA0761D6478BD642FUL;
+
+  static constexpr uint64_t kMixer = 0xE7037ED1A0B428DBUL;
+
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  static constexpr auto
+  Mum(  //
+      const uint64_t a,
+      const uint64_t b)  //
+      -> uint64_t
+  {
+    const auto r = static_cast<__uint128_t>(a) * b;
+    return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64U);
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// a counter to generate random values.
+  uint64_t state_{0};
+};
+
+/*##############################################################################
+ * Type aliases
+ *############################################################################*/
+
+#if defined(INDEX_BENCH_RAND_ENGINE_XOSHIRO256PP)
+/// a random engine to generate workloads.
+using RandEngine_t = Xoshiro256PlusPlus;
+#elif defined(INDEX_BENCH_RAND_ENGINE_WYRAND)
+/// a random engine to generate workloads.
+using RandEngine_t = WyRand;
+#else
+/// a random engine to generate workloads.
+using RandEngine_t = std::mt19937_64;
+#endif
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_WORKLOAD_RAND_ENGINE_HPP
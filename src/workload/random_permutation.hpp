@@ -0,0 +1,158 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_BENCHMARK_WORKLOAD_RANDOM_PERMUTATION_HPP
+#define INDEX_BENCHMARK_WORKLOAD_RANDOM_PERMUTATION_HPP
+
+// C++ standard libraries
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace dbgroup
+{
+
+/**
+ * @brief A class for computing a pseudo-random permutation of [0, n) on the fly.
+ *
+ * This class uses a balanced Feistel network over the smallest domain of 2^(2b)
+ * that covers [0, n), and it re-encrypts outputs that fall outside of [0, n)
+ * (i.e., cycle-walking). Thus, `Permute` is a bijection on [0, n) determined
+ * only by a random seed, and it requires no memory proportional to n.
+ */
+class RandomPermutation
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  constexpr RandomPermutation() = default;
+
+  /**
+   * @param n the size of a domain.
+   * @param seed a random seed to select a permutation.
+   */
+  constexpr RandomPermutation(  //
+      const uint64_t n,
+      const uint64_t seed)
+      : n_{n}
+  {
+    while (half_bits_ < 32 && (1UL << (2 * half_bits_)) < n_) {
+      ++half_bits_;
+    }
+    half_mask_ = (1UL << half_bits_) - 1UL;
+
+    auto state = seed;
+    for (auto &&key : keys_) {
+      state += kGoldenGamma;
+      key = Mix(state);
+    }
+  }
+
+  constexpr RandomPermutation(const RandomPermutation &) = default;
+  constexpr RandomPermutation(RandomPermutation &&) = default;
+
+  constexpr auto operator=(const RandomPermutation &) -> RandomPermutation & = default;
+  constexpr auto operator=(RandomPermutation &&) -> RandomPermutation & = default;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~RandomPermutation() = default;
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @param i a value in [0, n).
+   * @return the permuted value of `i` in [0, n).
+   */
+  [[nodiscard]] constexpr auto
+  Permute(const uint64_t i) const  //
+      -> uint64_t
+  {
+    auto val = Encrypt(i);
+    while (val >= n_) {
+      val = Encrypt(val);
+    }
+    return val;
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// the number of Feistel rounds.
+  static constexpr size_t kRoundNum = 4;
+
+  /// an odd constant derived from the golden ratio.
+  static constexpr uint64_t kGoldenGamma = 0x9E3779B97F4A7C15UL;
+
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Mix the bits of a given value (the finalizer of SplitMix64).
+   *
+   */
+  static constexpr auto
+  Mix(uint64_t x)  //
+      -> uint64_t
+  {
+    x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9UL;
+    x = (x ^ (x >> 27U)) * 0x94D049BB133111EBUL;
+    return x ^ (x >> 31U);
+  }
+
+  [[nodiscard]] constexpr auto
+  Encrypt(const uint64_t val) const  //
+      -> uint64_t
+  {
+    auto left = val >> half_bits_;
+    auto right = val & half_mask_;
+    for (const auto key : keys_) {
+      const auto tmp = right;
+      right = left ^ (Mix(right ^ key) & half_mask_);
+      left = tmp;
+    }
+    return (left << half_bits_) | right;
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// the size of a domain.
+  uint64_t n_{1};
+
+  /// the number of bits in each half of the Feistel network.
+  uint64_t half_bits_{1};
+
+  /// a bit mask to extract each half.
+  uint64_t half_mask_{1};
+
+  /// round keys.
+  std::array<uint64_t, kRoundNum> keys_{};
+};
+
+}  // namespace dbgroup
+
+#endif  // INDEX_BENCHMARK_WORKLOAD_RANDOM_PERMUTATION_HPP
@@ -18,8 +18,16 @@
 #define INDEX_BENCHMARK_WORKLOAD_WORKLOAD_HPP
 
 // C++ standard libraries
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
 #include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <variant>
+#include <vector>
 
 // external sources
 #include "nlohmann/json.hpp"
@@ -27,6 +35,10 @@
 
 // local sources
 #include "common.hpp"
+#include "alias_table.hpp"
+#include "length_distribution.hpp"
+#include "rand_engine.hpp"
+#include "random_permutation.hpp"
 
 namespace dbgroup
 {
@@ -42,11 +54,179 @@ class Workload
    *##########################################################################*/
 
   using Json_t = ::nlohmann::json;
-  using ExactZipf_t = ::dbgroup::random::ZipfDistribution<uint32_t>;
-  using ApproxZipf_t = ::dbgroup::random::ApproxZipfDistribution<uint32_t>;
-  using KeyDist = std::variant<ExactZipf_t, ApproxZipf_t, std::uniform_int_distribution<uint32_t>>;
+  using ExactZipf_t = ::dbgroup::random::ZipfDistribution<KeyID>;
+  using ApproxZipf_t = ::dbgroup::random::ApproxZipfDistribution<KeyID>;
+  using KeyDist = std::variant<ExactZipf_t, ApproxZipf_t, std::uniform_int_distribution<KeyID>>;
 
  public:
+  /*############################################################################
+   * Public inner classes
+   *##########################################################################*/
+
+  /**
+   * @brief A class for generating the operations of a phase incrementally.
+   *
+   * This class retains the random engine and distributions for a worker thread,
+   * so operations can be produced chunk by chunk without materializing them. A
+   * generator shares a copy of its workload, so it remains valid even if the
+   * original workload is destroyed (e.g., by re-parsing workloads).
+   */
+  class Generator
+  {
+   public:
+    /*##########################################################################
+     * Public constructors and assignment operators
+     *########################################################################*/
+
+    Generator(  //
+        std::shared_ptr<const Workload> workload,
+        const size_t worker_id,
+        const size_t worker_num,
+        const size_t random_seed,
+        const size_t group_id = 0)
+        : workload_{std::move(workload)},
+          group_id_{group_id},
+          worker_id_{worker_id},
+          worker_num_{worker_num},
+          rand_engine_{random_seed},
+          key_dist_{workload_->GetKeyDistribution(worker_id, worker_num)}
+    {
+      if (workload_->access_pattern_ == kRandom && workload_->partition_ != kNone) {
+        const auto key_num = workload_->GetPartitionKeyNum(worker_id, worker_num);
+        key_perm_ = RandomPermutation{key_num, rand_engine_()};
+      } else if (workload_->scrambled_) {
+        // all the workers must scatter hot keys into the same positions
+        key_perm_ = RandomPermutation{workload_->key_num_, kScrambleSeed};
+      }
+    }
+
+    Generator(const Generator &) = default;
+    Generator(Generator &&) = default;
+
+    auto operator=(const Generator &) -> Generator & = default;
+    auto operator=(Generator &&) -> Generator & = default;
+
+    /*##########################################################################
+     * Public destructors
+     *########################################################################*/
+
+    ~Generator() = default;
+
+    /*##########################################################################
+     * Public getters
+     *########################################################################*/
+
+    /**
+     * @return the ID of the thread group that this generator belongs to.
+     */
+    [[nodiscard]] constexpr auto
+    GetGroupID() const  //
+        -> size_t
+    {
+      return group_id_;
+    }
+
+    /**
+     * @return the only operation type generated (`kUndefinedOperation` if mixed).
+     */
+    [[nodiscard]] auto
+    GetSingleOperation() const  //
+        -> IndexOperation
+    {
+      return workload_->single_ops_;
+    }
+
+    /*##########################################################################
+     * Public utilities
+     *########################################################################*/
+
+    /**
+     * @retval true if the last operation is in the middle of a batch of multi reads.
+     * @retval false otherwise.
+     */
+    [[nodiscard]] constexpr auto
+    IsInBatch() const  //
+        -> bool
+    {
+      return batch_remain_ > 0;
+    }
+
+    /**
+     * @tparam Operation a class to represent operations.
+     * @return the next operation of this phase.
+     * @note A batch of multi reads is generated as consecutive operations, and each
+     * of them has the number of the remaining keys in the batch (including itself).
+     */
+    template <class Operation>
+    auto
+    Next()  //
+        -> Operation
+    {
+      const auto ops = (batch_remain_ > 0)
+                           ? kMultiRead
+                           : workload_->ops_table_.Sample(ratio_dist_(rand_engine_));
+      auto key = (workload_->access_pattern_ == kLatest)
+                     ? workload_->GetLatestKeyID(ops, key_dist_, rand_engine_)
+                     : workload_->GetKeyID(key_dist_, key_perm_, rand_engine_, count_++,
+                                           worker_id_, worker_num_);
+      if ((ops == kRead || ops == kMultiRead) && workload_->miss_ratio_ > 0
+          && ratio_dist_(rand_engine_) < workload_->miss_ratio_) {
+        key = workload_->GetAbsentKeyID(key);
+      }
+      const auto is_scan = ops == kScan || ops == kRangeScan || ops == kReverseScan;
+      size_t val{};
+      if (is_scan) {
+        val = workload_->scan_length_dist_(rand_engine_);
+      } else if (ops == kMultiRead) {
+        if (batch_remain_ == 0) {
+          batch_remain_ = workload_->multi_read_size_;
+        }
+        val = batch_remain_--;
+      } else {
+        val = value_dist_(rand_engine_);
+      }
+      return Operation{ops, key, static_cast<uint32_t>(val)};
+    }
+
+   private:
+    /*##########################################################################
+     * Internal member variables
+     *########################################################################*/
+
+    /// a workload that defines this phase.
+    std::shared_ptr<const Workload> workload_{nullptr};
+
+    /// the ID of a thread group in this phase.
+    size_t group_id_{0};
+
+    /// the ID of a worker thread (in its thread group).
+    size_t worker_id_{0};
+
+    /// the total number of worker threads (in the thread group).
+    size_t worker_num_{1};
+
+    /// the number of generated operations.
+    size_t count_{0};
+
+    /// the number of multi reads to be generated for the current batch.
+    size_t batch_remain_{0};
+
+    /// a random engine for this generator.
+    RandEngine_t rand_engine_{};
+
+    /// a distribution to select target keys.
+    KeyDist key_dist_{};
+
+    /// a permutation to access partitioned keys randomly.
+    RandomPermutation key_perm_{};
+
+    /// a distribution to select written values.
+    std::uniform_int_distribution<size_t> value_dist_{0, kMaxWrittenValue};
+
+    /// a distribution to select operation types.
+    std::uniform_real_distribution<double> ratio_dist_{0.0, 1.0};
+  };
+
   /*############################################################################
    * Public constructors and assignment operators
    *##########################################################################*/
@@ -54,12 +234,16 @@ class Workload
   Workload() = default;
 
   explicit Workload(const Json_t &json)
-      : ops_cum_dist_{},
-        key_num_{json.at("# of keys")},
+      : key_num_{json.at("# of keys")},
         access_pattern_{json.at("access pattern").get<AccessPattern>()},
         partition_{json.at("partitioning policy").get<Partitioning>()},
         execution_ratio_{json.value("execution ratio", 1.0)},
-        skew_parameter_{json.value("skew parameter", 0.0)}
+        skew_parameter_{json.value("skew parameter", 0.0)},
+        scrambled_{json.value("scrambled zipf", false)},
+        drift_{json.value("hotspot drift", 0.0)},
+        duration_{json.value("duration", 0.0)},
+        miss_ratio_{json.value("miss ratio", 0.0)},
+        multi_read_size_{json.value("multi read size", 16UL)}
   {
     // check access pattern and create the Zipf's law engine if needed
     if (access_pattern_ == kUndefinedAccessPattern) {
@@ -69,6 +253,56 @@ class Workload
       throw std::runtime_error{err_msg};
     }
 
+    // scrambling is only meaningful for skewed random accesses over all the keys
+    if (scrambled_ && (access_pattern_ != kRandom || partition_ != kNone)) {
+      throw std::runtime_error{"ERROR: scrambled Zipf requires non-partitioned random access."};
+    }
+
+    // check the phase length
+    if (duration_ < 0) {
+      throw std::runtime_error{"ERROR: the duration of a phase must be non-negative."};
+    }
+
+    // hot spots can drift only over all the keys
+    if (drift_ < 0) {
+      throw std::runtime_error{"ERROR: the hotspot drift must be non-negative."};
+    }
+    if (drift_ > 0 && (access_pattern_ != kRandom || partition_ != kNone)) {
+      throw std::runtime_error{"ERROR: hotspot drift requires non-partitioned random access."};
+    }
+
+    // the latest keys are shared by all the workers
+    if (access_pattern_ == kLatest) {
+      if (partition_ != kNone) {
+        throw std::runtime_error{"ERROR: the latest access pattern cannot be partitioned."};
+      }
+      frontier_ = std::make_shared<std::atomic<size_t>>(key_num_);
+    }
+
+    // check all the keys can be identified
+    if (key_num_ > std::numeric_limits<KeyID>::max()) {
+      std::string err_msg = "ERROR: the number of keys must be less than or equal to ";
+      err_msg += std::to_string(std::numeric_limits<KeyID>::max());
+      err_msg += " (build with INDEX_BENCH_USE_64BIT_KEY_IDS for more keys).";
+      throw std::runtime_error{err_msg};
+    }
+
+    // absent keys are mirrored from the tail of the key ID space
+    if (miss_ratio_ < 0 || miss_ratio_ > 1) {
+      throw std::runtime_error{"ERROR: the miss ratio must be in [0, 1]."};
+    }
+    if (miss_ratio_ > 0 && key_num_ > std::numeric_limits<KeyID>::max() / 2) {
+      throw std::runtime_error{"ERROR: too many keys to reserve absent keys for the miss ratio."};
+    }
+
+    // a batch of multi reads is buffered by each worker
+    if (multi_read_size_ == 0 || multi_read_size_ > kMaxMultiReadSize) {
+      std::string err_msg = "ERROR: the multi read size must be in [1, ";
+      err_msg += std::to_string(kMaxMultiReadSize);
+      err_msg += "].";
+      throw std::runtime_error{err_msg};
+    }
+
     // check partitioning policy
     if (partition_ == kUndefinedPartitioning) {
       std::string err_msg = "ERROR: an undefined partitioning policy (";
@@ -77,11 +311,28 @@ class Workload
       throw std::runtime_error{err_msg};
     }
 
+    // thread groups override the settings of this phase
+    if (json.contains("thread groups")) {
+      ParseThreadGroupsJson(json);
+      if (!json.contains("operation ratios")) return;
+    }
+
     // compute cumulative distribution for operations
     const auto &ops_ratios = json.at("operation ratios");
     ParseOperationsJson(ops_ratios);
-    if (ops_ratios.contains("scan") && ops_ratios.at("scan") > 0) {
-      scan_length_ = json.at("scan length");
+
+    // the scan length is also used as the span of range scans
+    const auto has_scan = [&](const char *ops) {
+      return ops_ratios.contains(ops) && ops_ratios.at(ops) > 0;
+    };
+    if (has_scan("scan") || has_scan("range scan") || has_scan("reverse scan")) {
+      scan_length_dist_ = LengthDistribution{json.at("scan length"), "scan length"};
+      if (scan_length_dist_.GetMax() > kMaxScanLength) {
+        std::string err_msg = "ERROR: the scan length must be less than or equal to ";
+        err_msg += std::to_string(kMaxScanLength);
+        err_msg += ".";
+        throw std::runtime_error{err_msg};
+      }
     }
   }
 
@@ -109,6 +360,60 @@ class Workload
     return execution_ratio_;
   }
 
+  /**
+   * @return the duration of this phase in seconds (zero if count-based).
+   */
+  constexpr auto
+  GetDuration() const  //
+      -> double
+  {
+    return duration_;
+  }
+
+  /**
+   * @return the only operation type in this phase (`kUndefinedOperation` if mixed).
+   */
+  [[nodiscard]] constexpr auto
+  GetSingleOperation() const  //
+      -> IndexOperation
+  {
+    return single_ops_;
+  }
+
+  /**
+   * @retval true if reads target absent keys taken from the tail of the key ID space.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto
+  UsesAbsentKeys() const  //
+      -> bool
+  {
+    return miss_ratio_ > 0
+           || std::any_of(groups_.begin(), groups_.end(),
+                          [](const auto &group) { return group.second.miss_ratio_ > 0; });
+  }
+
+  /**
+   * @retval true if inserts append keys after the key space (i.e., the latest pattern).
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto
+  AppendsKeys() const  //
+      -> bool
+  {
+    return static_cast<bool>(frontier_);
+  }
+
+  /**
+   * @return the names of thread groups (empty if all the workers share settings).
+   */
+  [[nodiscard]] auto
+  GetThreadGroupNames() const  //
+      -> const std::vector<std::string> &
+  {
+    return group_names_;
+  }
+
   /*############################################################################
    * Public utilities
    *##########################################################################*/
@@ -120,21 +425,72 @@ class Workload
       const size_t ops_num,
       const size_t worker_id,
       const size_t worker_num,
-      const size_t random_seed)
+      const size_t random_seed) const
   {
-    std::mt19937_64 rand_engine{random_seed};
+    auto &&gen = GetGenerator(worker_id, worker_num, random_seed);
+    for (size_t i = 0; i < ops_num; ++i) {
+      operations.emplace_back(gen.Next<Operation>());
+    }
+  }
 
-    auto key_dist = GetKeyDistribution(worker_id, worker_num);
-    std::uniform_int_distribution<size_t> value_dist{0, 256};
-    std::uniform_real_distribution<double> ratio_dist{0.0, 1.0};
+  /**
+   * @brief Create a generator to produce the operations of this phase one by one.
+   *
+   * The generated operations are the same as ones added by `AddOperations` with
+   * the same arguments.
+   *
+   * @param worker_id the ID of a worker thread.
+   * @param worker_num the total number of worker threads.
+   * @param random_seed a random seed for this phase.
+   * @return a generator of operations.
+   */
+  auto
+  GetGenerator(  //
+      const size_t worker_id,
+      const size_t worker_num,
+      const size_t random_seed) const  //
+      -> Generator
+  {
+    if (groups_.empty()) {
+      return Generator{std::make_shared<const Workload>(*this), worker_id, worker_num, random_seed};
+    }
 
-    // generate an operation-queue for benchmarking
-    for (size_t i = 0; i < ops_num; ++i) {
-      const auto ops = GetOperationType(ratio_dist(rand_engine));
-      const auto key = GetKeyID(key_dist, rand_engine, i, worker_id, worker_num);
-      const auto val = (ops == kScan) ? scan_length_ : value_dist(rand_engine);
-      operations.emplace_back(ops, key, val);
+    // find the thread group of the worker and its ID in the group
+    size_t group_begin = 0;
+    size_t group_id = 0;
+    for (; group_id < groups_.size(); ++group_id) {
+      const auto group_num = groups_[group_id].first;
+      if (worker_id < group_begin + group_num) break;
+      group_begin += group_num;
+    }
+    if (group_id >= groups_.size() || group_total_ != worker_num) {
+      std::string err_msg = "ERROR: thread groups require ";
+      err_msg += std::to_string(group_total_);
+      err_msg += " worker threads.";
+      throw std::runtime_error{err_msg};
     }
+
+    const auto &[group_num, group] = groups_[group_id];
+    return Generator{std::make_shared<const Workload>(group), worker_id - group_begin, group_num,
+                     random_seed, group_id};
+  }
+
+  /**
+   * @brief Fill a buffer with operation types sampled by the ratios of this phase.
+   *
+   * @tparam RandEngine a class of random engines.
+   * @param out a buffer to write operation types.
+   * @param n the number of operation types to be sampled.
+   * @param rand_engine a random engine.
+   */
+  template <class RandEngine>
+  void
+  FillOperationTypes(  //
+      IndexOperation *out,
+      const size_t n,
+      RandEngine &rand_engine) const
+  {
+    ops_table_.Fill(out, n, rand_engine);
   }
 
  private:
@@ -145,7 +501,9 @@ class Workload
   void
   ParseOperationsJson(const Json_t &ops_ratios)
   {
-    double cum_val = 0;
+    std::vector<std::pair<IndexOperation, double>> ratios{};
+    double sum = 0;
+    size_t non_zero_num = 0;
     for (const auto &[key, val] : ops_ratios.items()) {
       // check the given key is a valid operation
       Json_t ops_j = key;  // parse a key string to JSON
@@ -157,55 +515,113 @@ class Workload
         throw std::runtime_error{err_msg};
       }
 
-      // compute a cumulative value for simplicity
-      cum_val += val.get<double>();
-      ops_cum_dist_.emplace_back(ops, cum_val);
+      sum += val.get<double>();
+      ratios.emplace_back(ops, val.get<double>());
+      if (val.get<double>() > 0) {
+        // keep an operation type only if the other ones are never executed
+        single_ops_ = (++non_zero_num == 1) ? ops : kUndefinedOperation;
+      }
     }
 
     // check the given workload is valid
-    if (!AlmostEqual(cum_val, 1.0)) {
+    if (!AlmostEqual(sum, 1.0)) {
       throw std::runtime_error{"ERROR: the sum of operation ratios is not one."};
     }
+    ops_table_ = AliasTable<IndexOperation>{ratios};
+  }
+
+  /**
+   * @brief Create a workload for each thread group.
+   *
+   * Each group is given as the number of threads and settings that override the
+   * ones of this phase (e.g., `operation ratios` and `access pattern`). Workers
+   * are assigned to groups in order, and partitioning is applied in each group.
+   * The groups with the latest access pattern share the insert frontier of this
+   * phase, which starts from the number of keys of the first such group.
+   *
+   */
+  void
+  ParseThreadGroupsJson(const Json_t &json)
+  {
+    auto base_json = json;
+    base_json.erase("thread groups");
+    for (const auto &g_json : json.at("thread groups")) {
+      if (g_json.contains("thread groups")) {
+        throw std::runtime_error{"ERROR: thread groups cannot be nested."};
+      }
+      const size_t thread_num = g_json.at("# of threads");
+      if (thread_num == 0) {
+        throw std::runtime_error{"ERROR: a thread group must have at least one thread."};
+      }
+
+      auto merged_json = base_json;
+      for (const auto &[key, val] : g_json.items()) {
+        if (key == "# of threads" || key == "name") continue;
+        merged_json[key] = val;
+      }
+      Workload group{merged_json};
+      if (group.frontier_) {
+        // all the groups in this phase insert and read keys around the same frontier
+        if (!frontier_) {
+          frontier_ = group.frontier_;
+        }
+        group.frontier_ = frontier_;
+      }
+      group_names_.emplace_back(
+          g_json.value("name", std::string{"group "} + std::to_string(groups_.size())));
+      groups_.emplace_back(thread_num, std::move(group));
+      group_total_ += thread_num;
+    }
+    if (groups_.empty()) {
+      throw std::runtime_error{"ERROR: no thread group is given."};
+    }
   }
 
   auto
-  GetKeyDistribution(  //
+  GetPartitionKeyNum(  //
       const size_t w_id,
       const size_t w_num) const  //
-      -> KeyDist
+      -> KeyID
   {
-    const uint32_t key_num = (partition_ == kNone) ? key_num_ : (key_num_ - (w_id + 1)) / w_num + 1;
-
-    if (skew_parameter_ == 0) return std::uniform_int_distribution<uint32_t>{0, key_num - 1};
-    return ApproxZipf_t{0, key_num - 1, skew_parameter_};
+    return (partition_ == kNone) ? key_num_ : (key_num_ - (w_id + 1)) / w_num + 1;
   }
 
   auto
-  GetOperationType(const double rand_val) const  //
-      -> IndexOperation
+  GetKeyDistribution(  //
+      const size_t w_id,
+      const size_t w_num) const  //
+      -> KeyDist
   {
-    for (const auto [ops, cum_val] : ops_cum_dist_) {
-      if (rand_val < cum_val) return ops;
-    }
-    return ops_cum_dist_.back().first;
+    const auto key_num = GetPartitionKeyNum(w_id, w_num);
+
+    if (skew_parameter_ == 0) return std::uniform_int_distribution<KeyID>{0, key_num - 1};
+    return ApproxZipf_t{0, key_num - 1, skew_parameter_};
   }
 
   auto
   GetKeyID(  //
       KeyDist &key_dist,
-      std::mt19937_64 &rand_engine,
-      const uint32_t i,
+      const RandomPermutation &key_perm,
+      RandEngine_t &rand_engine,
+      const size_t i,
       const size_t w_id,
       const size_t w_num) const  //
-      -> uint32_t
+      -> KeyID
   {
-    const uint32_t key_num = (partition_ == kNone) ? key_num_ : (key_num_ - (w_id + 1)) / w_num + 1;
-    uint32_t key_id{};
+    const auto key_num = GetPartitionKeyNum(w_id, w_num);
+    KeyID key_id{};
     if (access_pattern_ == kRandom && partition_ == kNone) {
       key_id = std::visit([&](auto &dist) { return dist(rand_engine); }, key_dist);
+      if (drift_ > 0) {
+        // estimate the number of operations executed by all the workers so far
+        const auto shift = static_cast<size_t>(drift_ * (static_cast<double>(i) * w_num / 1e6));
+        key_id = (key_id + shift) % key_num;
+      }
+      if (scrambled_) {
+        key_id = key_perm.Permute(key_id);
+      }
     } else if (access_pattern_ == kRandom) {  // the stripe or range partitioning
-      thread_local const auto &rand_keys = CreateRandomKeyIDs(key_num, rand_engine);
-      key_id = rand_keys.at(i % key_num);
+      key_id = key_perm.Permute(i % key_num);
     } else if (access_pattern_ == kAscending) {
       key_id = i % key_num;
     } else {  // access_pattern_ == kDescending
@@ -216,32 +632,61 @@ class Workload
     if (partition_ == kStripe) return key_id * w_num + w_id;
 
     // partition_ == kRange
-    const uint32_t pad = key_num_ % w_num;
-    const uint32_t begin_pos = (key_num_ / w_num) * w_id + ((w_id < pad) ? w_id : pad);
+    const KeyID pad = key_num_ % w_num;
+    const KeyID begin_pos = (key_num_ / w_num) * w_id + ((w_id < pad) ? w_id : pad);
     return begin_pos + key_id;
   }
 
-  static auto
-  CreateRandomKeyIDs(  //
-      const size_t key_num,
-      std::mt19937_64 &rand_engine)  //
-      -> std::vector<uint32_t>
+  /**
+   * @brief Convert a key ID into one that is never loaded or inserted.
+   *
+   * Existing keys are assigned from the head of the key ID space, so absent keys
+   * are taken from its tail. Mirroring keeps the skewness of the given key.
+   *
+   */
+  static constexpr auto
+  GetAbsentKeyID(const KeyID key_id)  //
+      -> KeyID
   {
-    std::vector<uint32_t> key_ids{};
-    key_ids.reserve(key_num);
-    for (size_t i = 0; i < key_num; ++i) {
-      key_ids.emplace_back(i);
-    }
-    std::shuffle(key_ids.begin(), key_ids.end(), rand_engine);
+    return std::numeric_limits<KeyID>::max() - key_id;
+  }
+
+  /**
+   * @brief Select a target key around the insert frontier shared by all workers.
+   *
+   * Insert operations append a new key to the frontier. The other operations
+   * select an existing key by an offset backward from the frontier, so a skewed
+   * offset distribution concentrates them on recently inserted keys.
+   *
+   */
+  auto
+  GetLatestKeyID(  //
+      const IndexOperation ops,
+      KeyDist &key_dist,
+      RandEngine_t &rand_engine) const  //
+      -> KeyID
+  {
+    if (ops == kInsert) return frontier_->fetch_add(1, std::memory_order_relaxed);
 
-    return key_ids;
+    const auto offset = std::visit([&](auto &dist) { return dist(rand_engine); }, key_dist);
+    return frontier_->load(std::memory_order_relaxed) - 1 - offset;
   }
 
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// a fixed random seed to scatter hot keys in scrambled Zipf.
+  static constexpr uint64_t kScrambleSeed = 0x5CA3B1EDUL;
+
   /*############################################################################
    * Internal member variables
    *##########################################################################*/
 
-  std::vector<std::pair<IndexOperation, double>> ops_cum_dist_{std::make_pair(kRead, 1.0)};
+  AliasTable<IndexOperation> ops_table_{{std::make_pair(kRead, 1.0)}};
+
+  /// the only operation type in this phase (`kUndefinedOperation` if mixed).
+  IndexOperation single_ops_{kRead};
 
   size_t key_num_{1000000};
 
@@ -253,7 +698,35 @@ class Workload
 
   double skew_parameter_{0};
 
-  size_t scan_length_{1000};
+  /// a flag for scattering the ranks of Zipf's law over the key space.
+  bool scrambled_{false};
+
+  /// the number of keys that hot spots slide per million operations.
+  double drift_{0};
+
+  /// the wall-clock duration of this phase in seconds.
+  double duration_{0};
+
+  /// the fraction of read operations that target absent keys.
+  double miss_ratio_{0};
+
+  /// the number of keys read at once by multi reads.
+  size_t multi_read_size_{16};
+
+  /// a fixed scan length or a distribution of scan lengths.
+  LengthDistribution scan_length_dist_{};
+
+  /// the next key ID to be inserted in the latest access pattern.
+  std::shared_ptr<std::atomic<size_t>> frontier_{};
+
+  /// pairs of the number of threads and the workload of each thread group.
+  std::vector<std::pair<size_t, Workload>> groups_{};
+
+  /// the name of each thread group.
+  std::vector<std::string> group_names_{};
+
+  /// the total number of threads in all the thread groups.
+  size_t group_total_{0};
 };
 
 }  // namespace dbgroup
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "workload/alias_table.hpp"
+
+// C++ standard libraries
+#include <random>
+#include <utility>
+#include <vector>
+
+// external sources
+#include "gtest/gtest.h"
+
+namespace dbgroup
+{
+
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kRandomSeed = 20;
+
+constexpr size_t kRepeatNum = 1e6;
+
+constexpr double kAllowableError = 0.01;
+
+/*##############################################################################
+ * Utility functions
+ *############################################################################*/
+
+void
+VerifySampledRatios(const std::vector<std::pair<size_t, double>> &weights)
+{
+  const AliasTable<size_t> table{weights};
+  double sum = 0;
+  for (const auto &[item, w] : weights) {
+    sum += w;
+  }
+
+  std::vector<size_t> sampled(kRepeatNum);
+  std::mt19937_64 rand_engine{kRandomSeed};
+  table.Fill(sampled.data(), kRepeatNum, rand_engine);
+
+  std::vector<size_t> counts(weights.size(), 0);
+  for (const auto item : sampled) {
+    ASSERT_LT(item, weights.size());
+    ++counts.at(item);
+  }
+  for (size_t i = 0; i < weights.size(); ++i) {
+    const auto ratio = static_cast<double>(counts.at(i)) / kRepeatNum;
+    EXPECT_NEAR(ratio, weights.at(i).second / sum, kAllowableError);
+  }
+}
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(AliasTableTest, SingleItemIsAlwaysSampled)
+{
+  const AliasTable<size_t> table{{std::make_pair(0UL, 1.0)}};
+
+  EXPECT_EQ(table.Sample(0.0), 0UL);
+  EXPECT_EQ(table.Sample(0.5), 0UL);
+  EXPECT_EQ(table.Sample(1.0 - 1e-16), 0UL);
+}
+
+TEST(AliasTableTest, UniformWeightsAreSampledUniformly)
+{
+  std::vector<std::pair<size_t, double>> weights{};
+  for (size_t i = 0; i < 11; ++i) {
+    weights.emplace_back(i, 1.0 / 11);
+  }
+
+  VerifySampledRatios(weights);
+}
+
+TEST(AliasTableTest, SkewedWeightsAreSampledProportionally)
+{
+  VerifySampledRatios({{0, 0.5}, {1, 0.05}, {2, 0.3}, {3, 0.15}});
+}
+
+TEST(AliasTableTest, ZeroWeightItemsAreNeverSampled)
+{
+  VerifySampledRatios({{0, 0.0}, {1, 0.95}, {2, 0.0}, {3, 0.05}});
+}
+
+TEST(AliasTableTest, FillSampleSameItemsAsSequentialCalls)
+{
+  const AliasTable<size_t> table{{{0, 0.2}, {1, 0.3}, {2, 0.5}}};
+  std::mt19937_64 engine_a{kRandomSeed};
+  std::mt19937_64 engine_b{kRandomSeed};
+  std::uniform_real_distribution<double> dist{0.0, 1.0};
+
+  std::vector<size_t> sampled(kRepeatNum);
+  table.Fill(sampled.data(), kRepeatNum, engine_a);
+  for (const auto item : sampled) {
+    EXPECT_EQ(item, table.Sample(dist(engine_b)));
+  }
+}
+
+TEST(AliasTableTest, InvalidWeightsAreRejected)
+{
+  using Weights = std::vector<std::pair<size_t, double>>;
+
+  EXPECT_THROW(AliasTable<size_t>{Weights{}}, std::runtime_error);
+  EXPECT_THROW((AliasTable<size_t>{Weights{{0, 0.0}}}), std::runtime_error);
+  EXPECT_THROW((AliasTable<size_t>{Weights{{0, -1.0}, {1, 2.0}}}), std::runtime_error);
+}
+
+}  // namespace dbgroup
@@ -0,0 +1,329 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "index.hpp"
+
+// C++ standard libraries
+#include <map>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// external sources
+#include "gtest/gtest.h"
+
+namespace dbgroup
+{
+
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kKeyNum = 1000;
+constexpr size_t kThreadNum = 1;
+
+/*##############################################################################
+ * A simple index for testing
+ *############################################################################*/
+
+/**
+ * @brief A thread-safe ordered map that provides the minimum index APIs.
+ *
+ */
+template <class Key, class Payload>
+class MapIndex
+{
+  using ScanKey = std::optional<std::tuple<const Key &, size_t, bool>>;
+  using Records_t = std::vector<std::pair<Key, Payload>>;
+
+ public:
+  MapIndex() { latest_ = this; }
+
+  class RecordIterator
+  {
+   public:
+    explicit RecordIterator(Records_t &&records) : records_{std::move(records)} {}
+
+    explicit
+    operator bool() const
+    {
+      return pos_ < records_.size();
+    }
+
+    void
+    operator++()
+    {
+      ++pos_;
+    }
+
+    [[nodiscard]] auto
+    GetPayload() const  //
+        -> Payload
+    {
+      return records_.at(pos_).second;
+    }
+
+   private:
+    Records_t records_{};
+
+    size_t pos_{0};
+  };
+
+  auto
+  Read(const Key &key)  //
+      -> std::optional<Payload>
+  {
+    const std::lock_guard guard{mtx_};
+    const auto it = map_.find(key);
+    if (it == map_.end()) return std::nullopt;
+    return it->second;
+  }
+
+  auto
+  Scan(  //
+      const ScanKey &begin_key = std::nullopt,
+      const ScanKey &end_key = std::nullopt)  //
+      -> RecordIterator
+  {
+    const std::lock_guard guard{mtx_};
+    auto &&begin = (begin_key) ? map_.lower_bound(std::get<0>(*begin_key)) : map_.begin();
+    auto &&end = map_.end();
+    if (end_key) {
+      const auto &[key, len, closed] = *end_key;
+      end = (closed) ? map_.upper_bound(key) : map_.lower_bound(key);
+    }
+    return RecordIterator{Records_t{begin, end}};
+  }
+
+  auto
+  Write(  //
+      const Key &key,
+      const Payload &payload)
+  {
+    const std::lock_guard guard{mtx_};
+    map_[key] = payload;
+    return kSuccess;
+  }
+
+  auto
+  Insert(  //
+      const Key &key,
+      const Payload &payload)
+  {
+    const std::lock_guard guard{mtx_};
+    return map_.emplace(key, payload).second ? kSuccess : kFailed;
+  }
+
+  auto
+  Update(  //
+      const Key &key,
+      const Payload &payload)
+  {
+    const std::lock_guard guard{mtx_};
+    const auto it = map_.find(key);
+    if (it == map_.end()) return kFailed;
+    it->second = payload;
+    return kSuccess;
+  }
+
+  auto
+  Delete(const Key &key)
+  {
+    const std::lock_guard guard{mtx_};
+    return (map_.erase(key) > 0) ? kSuccess : kFailed;
+  }
+
+  constexpr auto
+  Bulkload(  //
+      [[maybe_unused]] const Records_t &entries,
+      [[maybe_unused]] const size_t thread_num)  //
+      -> int
+  {
+    return kFailed;
+  }
+
+  /**
+   * @return the latest constructed instance to check its records in tests.
+   */
+  static auto
+  GetLatest()  //
+      -> MapIndex *
+  {
+    return latest_;
+  }
+
+ private:
+  std::mutex mtx_{};
+
+  std::map<Key, Payload> map_{};
+
+  static inline MapIndex *latest_{nullptr};
+};
+
+/**
+ * @brief A map-backed index that cannot stop a scan at an end key.
+ *
+ */
+template <class Key, class Payload>
+class MapIndexWOEndKey : public MapIndex<Key, Payload>
+{
+};
+
+template <>
+constexpr auto
+HasEndKeyScan<MapIndexWOEndKey>()  //
+    -> bool
+{
+  return false;
+}
+
+/**
+ * @brief A map-backed index that cannot continue a scan beyond a few records.
+ *
+ */
+template <class Key, class Payload>
+class MapIndexWOLongScan : public MapIndex<Key, Payload>
+{
+};
+
+template <>
+constexpr auto
+GetMaxScanLength<MapIndexWOLongScan>()  //
+    -> size_t
+{
+  return 4;
+}
+
+/*##############################################################################
+ * Fixture class definition
+ *############################################################################*/
+
+class IndexFixture : public ::testing::Test
+{
+ public:
+  using Key_t = uint64_t;
+  using Payload_t = uint64_t;
+  using Index_t = Index<Key_t, Payload_t, MapIndex>;
+  using Operation_t = Operation<Key_t, Payload_t>;
+
+ protected:
+  void
+  SetUp() override
+  {
+    const auto &entries = PrepareBulkLoadEntries<Key_t, Payload_t>(kKeyNum, kThreadNum);
+    index.Construct(entries, kThreadNum, false);
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Utility functions
+   *##########################################################################*/
+
+  static auto
+  Read(const KeyID id)  //
+      -> std::optional<Payload_t>
+  {
+    return MapIndex<Key_t, Payload_t>::GetLatest()->Read(id);
+  }
+
+  /*############################################################################
+   * Member variables
+   *##########################################################################*/
+
+  Index_t index{};
+};
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TEST_F(IndexFixture, ReadModifyWriteAddsValuesToStoredPayloads)
+{
+  std::vector<Operation_t> ops{};
+  for (KeyID id = 0; id < kKeyNum; id += 2) {
+    ops.emplace_back(kReadModifyWrite, id, 3);
+  }
+  ops.emplace_back(kReadModifyWrite, kKeyNum, 3);  // an absent key
+
+  // add values by both single and batched executions
+  index.SetUpForWorker();
+  for (const auto &op : ops) {
+    EXPECT_EQ(index.Execute(op), 1UL);
+  }
+  EXPECT_EQ(index.ExecuteAll(ops.data(), ops.size(), kReadModifyWrite), ops.size());
+  index.TearDownForWorker();
+
+  for (KeyID id = 0; id < kKeyNum; ++id) {
+    const auto &payload = Read(id);
+    ASSERT_TRUE(payload);
+    EXPECT_EQ(*payload, id + ((id % 2 == 0) ? 6 : 0));
+  }
+  EXPECT_FALSE(Read(kKeyNum));  // read-modify-writes do not insert absent keys
+}
+
+TEST_F(IndexFixture, MultiReadsAreExecutedInBatches)
+{
+  std::vector<Operation_t> ops{};
+  ops.emplace_back(kWrite, 0, 1);
+  for (uint32_t rem = 4; rem > 0; --rem) {
+    ops.emplace_back(kMultiRead, rem, rem);
+  }
+  ops.emplace_back(kMultiRead, 5, 2);  // a batch truncated by the end of a phase
+
+  EXPECT_EQ(Index_t::GetUnitSize(&(ops[0]), ops.size()), 1UL);
+  EXPECT_EQ(Index_t::GetUnitSize(&(ops[1]), ops.size() - 1), 4UL);
+  EXPECT_EQ(Index_t::GetUnitSize(&(ops[2]), 2), 2UL);
+  EXPECT_EQ(Index_t::GetUnitSize(&(ops[5]), 1), 1UL);
+
+  index.SetUpForWorker();
+  EXPECT_EQ(index.ExecuteAll(ops.data(), ops.size(), kUndefinedOperation), ops.size());
+  EXPECT_EQ(index.ExecuteAll(&(ops[1]), ops.size() - 1, kMultiRead), ops.size() - 1);
+  index.TearDownForWorker();
+}
+
+TEST_F(IndexFixture, RangeScanStopsBeforeEndKey)
+{
+  const Operation_t ops{kRangeScan, 10, 5};
+  EXPECT_EQ(ops.GetEndKey(), 15UL);
+  EXPECT_EQ(ops.GetEndKeyLength(), sizeof(Key_t));
+
+  index.SetUpForWorker();
+  EXPECT_EQ(index.Execute(ops), 5UL);
+  EXPECT_EQ(index.Execute(Operation_t{kRangeScan, kKeyNum - 2, 5}), 2UL);
+  EXPECT_EQ(index.Execute(Operation_t{kRangeScan, kKeyNum, 5}), 0UL);
+  index.TearDownForWorker();
+}
+
+TEST_F(IndexFixture, UnsupportedScansAreRejected)
+{
+  Index<Key_t, Payload_t, MapIndexWOEndKey> index_wo_end_key{};
+  EXPECT_THROW(index_wo_end_key.Execute(Operation_t{kRangeScan, 0, 5}), std::runtime_error);
+  EXPECT_THROW(index.Execute(Operation_t{kReverseScan, 0, 5}), std::runtime_error);
+
+  Index<Key_t, Payload_t, MapIndexWOLongScan> index_wo_long_scan{};
+  EXPECT_EQ(index_wo_long_scan.Execute(Operation_t{kScan, 0, 4}), 0UL);
+  EXPECT_THROW(index_wo_long_scan.Execute(Operation_t{kScan, 0, 5}), std::runtime_error);
+  EXPECT_THROW(index_wo_long_scan.Execute(Operation_t{kFullScan, 0, 0}), std::runtime_error);
+}
+
+}  // namespace dbgroup
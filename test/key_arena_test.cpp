@@ -0,0 +1,168 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "key_arena.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+// external sources
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+#include "workload/operation.hpp"
+
+namespace dbgroup
+{
+
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kKeyNum = 100000;
+
+constexpr size_t kThreadNum = 8;
+
+constexpr size_t kMinLen = 16;
+
+constexpr size_t kMaxLen = 300;
+
+constexpr double kAllowableError = 0.01;
+
+/*##############################################################################
+ * Utility functions
+ *############################################################################*/
+
+auto
+PrepareUniformLengths()  //
+    -> LengthDistribution
+{
+  const auto &len_json = ::nlohmann::json::parse(
+      R"({"uniform": {"min": )" + std::to_string(kMinLen) + R"(, "max": )"
+      + std::to_string(kMaxLen) + "}}");
+  return LengthDistribution{len_json, "key length"};
+}
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(KeyArenaTest, KeysHaveGivenLengthsAndKeepOrderOfIDs)
+{
+  const KeyArena arena{kKeyNum, PrepareUniformLengths(), kThreadNum};
+
+  ASSERT_EQ(arena.GetKeyNum(), kKeyNum);
+  size_t min_len = kMaxLen;
+  size_t max_len = 0;
+  for (size_t i = 0; i < kKeyNum + kThreadNum; ++i) {
+    const auto *key = arena.GetKey(i);
+    const auto len = arena.GetKeyLength(i);
+    ASSERT_EQ(std::strlen(key) + 1, len);
+    ASSERT_GE(len, kMinLen);
+    ASSERT_LE(len, kMaxLen);
+    min_len = std::min(min_len, len);
+    max_len = std::max(max_len, len);
+    if (i > 0) {
+      // the previous key is still valid in the arena or a buffer
+      ASSERT_LT(std::strcmp(arena.GetKey(i - 1), key), 0);
+    }
+  }
+
+  // lengths should differ within the arena
+  EXPECT_LT(min_len, kMinLen + 10);
+  EXPECT_GT(max_len, kMaxLen - 10);
+}
+
+TEST(KeyArenaTest, SameIDsHaveSameKeysInsideAndOutsideArenas)
+{
+  const KeyArena small{kKeyNum / 10, PrepareUniformLengths(), 1};
+  const KeyArena large{kKeyNum, PrepareUniformLengths(), kThreadNum};
+
+  for (size_t i = 0; i < kKeyNum; ++i) {
+    ASSERT_EQ(small.GetKeyLength(i), large.GetKeyLength(i));
+    ASSERT_STREQ(small.GetKey(i), large.GetKey(i));
+  }
+}
+
+TEST(KeyArenaTest, KeyLengthsFollowGivenHistogram)
+{
+  const auto &len_json = R"({"histogram": {"16": 0.8, "256": 0.2}})"_json;
+  const KeyArena arena{kKeyNum, LengthDistribution{len_json, "key length"}, kThreadNum};
+
+  size_t short_num = 0;
+  for (size_t i = 0; i < kKeyNum; ++i) {
+    const auto len = arena.GetKeyLength(i);
+    ASSERT_TRUE(len == 16 || len == 256);
+    if (len == 16) ++short_num;
+  }
+  EXPECT_NEAR(static_cast<double>(short_num) / kKeyNum, 0.8, kAllowableError);
+}
+
+TEST(KeyArenaTest, BuiltArenaIsUsedForVarLenKeys)
+{
+  KeyArena::Build(kKeyNum, PrepareUniformLengths(), kThreadNum);
+  ASSERT_NE(KeyArena::Get(), nullptr);
+
+  EXPECT_EQ(ToKey<char *>(1), KeyArena::Get()->GetKey(1));
+  EXPECT_EQ(ToKeyLength<char *>(1), KeyArena::Get()->GetKeyLength(1));
+  EXPECT_EQ(ToKeyLength<uint64_t>(1), sizeof(uint64_t));
+}
+
+TEST(KeyArenaTest, EndKeysOfRangeScansAreTakenFromArenas)
+{
+  KeyArena::Build(kKeyNum, PrepareUniformLengths(), kThreadNum);
+
+  const Operation<char *, uint64_t> ops{kRangeScan, 1, 10};
+  EXPECT_EQ(ops.GetEndKey(), KeyArena::Get()->GetKey(11));
+  EXPECT_EQ(ops.GetEndKeyLength(), KeyArena::Get()->GetKeyLength(11));
+}
+
+TEST(KeyArenaTest, FixedLenKeysAreMaterializedInAlignedMemory)
+{
+  using Key = VarLenData<128>;
+
+  EXPECT_EQ(ToKey<Key>(1), Key{1});
+  FixedLenKeyArena<Key>::Build(kKeyNum, kThreadNum, BuildKey<Key>);
+  const auto *arena = FixedLenKeyArena<Key>::Get();
+  ASSERT_NE(arena, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(&(arena->GetKey(0))) % 64, 0UL);
+
+  for (size_t i = 0; i < kKeyNum; ++i) {
+    const auto &key = ToKey<Key>(i);
+    ASSERT_EQ(&key, &(arena->GetKey(i)));
+    ASSERT_EQ(key, Key{static_cast<KeyID>(i)});
+  }
+
+  // keys outside the arena are built on demand
+  const auto &key = ToKey<Key>(kKeyNum);
+  EXPECT_EQ(key, Key{kKeyNum});
+  EXPECT_EQ(ToKey<Key>(kKeyNum + 1), Key{kKeyNum + 1});
+}
+
+TEST(KeyArenaTest, TooShortKeyLengthsAreRejected)
+{
+  const auto &len_json = R"({"uniform": {"min": 2, "max": 100}})"_json;
+  EXPECT_THROW((KeyArena{kKeyNum, LengthDistribution{len_json, "key length"}, 1}),
+               std::runtime_error);
+}
+
+}  // namespace dbgroup
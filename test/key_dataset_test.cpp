@@ -0,0 +1,173 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "key_dataset.hpp"
+
+// C++ standard libraries
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// external sources
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup
+{
+
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kKeyNum = 100000;
+
+constexpr uint64_t kKeyInterval = 1000;
+
+/*##############################################################################
+ * Utility functions
+ *############################################################################*/
+
+auto
+WriteDataset(  //
+    const std::vector<uint64_t> &keys,
+    const uint64_t key_num)  //
+    -> std::string
+{
+  const auto &path = std::filesystem::temp_directory_path() / "index_bench_test.sosd";
+  std::ofstream out{path, std::ios::binary | std::ios::trunc};
+  out.write(reinterpret_cast<const char *>(&key_num), sizeof(uint64_t));
+  out.write(reinterpret_cast<const char *>(keys.data()), keys.size() * sizeof(uint64_t));
+  return path;
+}
+
+auto
+PrepareSparseKeys()  //
+    -> std::vector<uint64_t>
+{
+  std::vector<uint64_t> keys{};
+  keys.reserve(kKeyNum);
+  for (size_t i = 0; i < kKeyNum; ++i) {
+    keys.emplace_back((i + 1) * kKeyInterval);
+  }
+  return keys;
+}
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(KeyDatasetTest, KeyIDsAreMappedToSortedKeys)
+{
+  const auto &path = WriteDataset(PrepareSparseKeys(), kKeyNum);
+  const KeyDataset dataset{path};
+
+  ASSERT_EQ(dataset.GetKeyNum(), kKeyNum);
+  for (size_t i = 0; i < kKeyNum; ++i) {
+    EXPECT_EQ(dataset.GetKey<uint64_t>(i), (i + 1) * kKeyInterval);
+  }
+
+  // keys beyond the dataset should be placed after the maximum key
+  EXPECT_EQ(dataset.GetKey<uint64_t>(kKeyNum), kKeyNum * kKeyInterval + 1);
+  EXPECT_EQ(dataset.GetKey<uint64_t>(kKeyNum + 9), kKeyNum * kKeyInterval + 10);
+
+  std::filesystem::remove(path);
+}
+
+TEST(KeyDatasetTest, LoadedDatasetIsUsedForAllKeys)
+{
+  EXPECT_EQ(ToKey<uint64_t>(1), 1UL);
+
+  const auto &path = WriteDataset(PrepareSparseKeys(), kKeyNum);
+  KeyDataset::Load(path);
+  ASSERT_NE(KeyDataset::Get(), nullptr);
+  EXPECT_EQ(ToKey<uint64_t>(1), 2 * kKeyInterval);
+
+  std::filesystem::remove(path);
+}
+
+TEST(KeyDatasetTest, InvalidDatasetsAreRejected)
+{
+  // unsorted keys
+  auto &&keys = PrepareSparseKeys();
+  std::swap(keys.at(0), keys.at(1));
+  auto path = WriteDataset(keys, kKeyNum);
+  EXPECT_THROW(KeyDataset{path}, std::runtime_error);
+
+  // a truncated file
+  path = WriteDataset(PrepareSparseKeys(), kKeyNum + 1);
+  EXPECT_THROW(KeyDataset{path}, std::runtime_error);
+
+  std::filesystem::remove(path);
+  EXPECT_THROW(KeyDataset{path}, std::runtime_error);
+}
+
+TEST(KeyDatasetTest, DuplicateKeysAreMergedIntoOneKeyID)
+{
+  auto &&keys = PrepareSparseKeys();
+  keys.at(1) = keys.at(0);
+  keys.at(2) = keys.at(0);
+  const auto &path = WriteDataset(keys, kKeyNum);
+  const KeyDataset dataset{path};
+
+  ASSERT_EQ(dataset.GetKeyNum(), kKeyNum - 2);
+  EXPECT_EQ(dataset.GetKey<uint64_t>(0), kKeyInterval);
+  for (size_t i = 1; i < kKeyNum - 2; ++i) {
+    EXPECT_EQ(dataset.GetKey<uint64_t>(i), (i + 3) * kKeyInterval);
+  }
+  EXPECT_EQ(dataset.GetKey<uint64_t>(kKeyNum - 2), kKeyNum * kKeyInterval + 1);
+
+  std::filesystem::remove(path);
+}
+
+TEST(KeyDatasetTest, KeysWrappingAroundAreRejected)
+{
+  constexpr auto kMaxKey = std::numeric_limits<uint64_t>::max();
+  constexpr uint64_t kAppendNum = 1000;
+  constexpr uint64_t kMaxID = kKeyNum - 1 + kAppendNum;
+
+  // the last key ID can be placed just at the maximum value
+  auto &&keys = PrepareSparseKeys();
+  keys.back() = kMaxKey - kAppendNum;
+  auto path = WriteDataset(keys, kKeyNum);
+  {
+    const KeyDataset dataset{path};
+    EXPECT_NO_THROW(dataset.CheckMaxKeyID(kMaxID));
+    EXPECT_EQ(dataset.GetKey<uint64_t>(kMaxID), kMaxKey);
+
+    // one more key ID wraps around
+    EXPECT_THROW(dataset.CheckMaxKeyID(kMaxID + 1), std::runtime_error);
+  }
+
+  // sparse keys can be used with any key IDs if they are not so large
+  path = WriteDataset(PrepareSparseKeys(), kKeyNum);
+  {
+    const KeyDataset dataset{path};
+    EXPECT_NO_THROW(dataset.CheckMaxKeyID(kKeyNum - 1));
+    EXPECT_NO_THROW(dataset.CheckMaxKeyID(std::numeric_limits<uint32_t>::max()));
+  }
+
+  std::filesystem::remove(path);
+}
+
+}  // namespace dbgroup
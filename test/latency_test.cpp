@@ -0,0 +1,97 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "latency.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <random>
+
+// external sources
+#include "gtest/gtest.h"
+
+namespace dbgroup
+{
+
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kLatencyNum = 1001;
+constexpr size_t kRandomSeed = 20;
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(LatencyTest, ScanLengthsAreBucketedByPowersOfTwo)
+{
+  EXPECT_EQ(GetScanBucket(0), 0UL);
+  EXPECT_EQ(GetScanBucket(1), 0UL);
+  EXPECT_EQ(GetScanBucket(2), 1UL);
+  EXPECT_EQ(GetScanBucket(3), 1UL);
+  EXPECT_EQ(GetScanBucket(4), 2UL);
+  EXPECT_EQ(GetScanBucket(1000), 9UL);
+  EXPECT_EQ(GetScanBucket(1024), 10UL);
+
+  // the longest scan length fits in the last bucket
+  EXPECT_EQ(GetScanBucket((1UL << kOpsValueBitNum) - 1), kScanBucketNum - 1);
+}
+
+TEST(LatencyTest, PercentilesArePickedFromSortedLatencies)
+{
+  Latencies_t latencies{};
+  for (size_t i = 0; i < kLatencyNum; ++i) {
+    latencies.emplace_back(i * 10);
+  }
+  std::shuffle(latencies.begin(), latencies.end(), std::mt19937_64{kRandomSeed});
+
+  const auto &percentiles = ComputePercentiles(latencies);
+  const Percentiles_t expected = {0, 5000, 9000, 9500, 9900, 9990, 10000};
+  EXPECT_EQ(percentiles, expected);
+  EXPECT_TRUE(std::is_sorted(latencies.begin(), latencies.end()));
+}
+
+TEST(LatencyTest, PercentilesOfEmptyOrSingleLatenciesAreDefined)
+{
+  Latencies_t latencies{};
+  const auto &percentiles = ComputePercentiles(latencies);
+  EXPECT_EQ(percentiles, Percentiles_t{});
+
+  latencies.emplace_back(42);
+  for (const auto lat : ComputePercentiles(latencies)) {
+    EXPECT_EQ(lat, 42);
+  }
+}
+
+TEST(LatencyTest, SampledLatenciesAreBoundedAndUniform)
+{
+  constexpr size_t kMeasuredNum = 4 * kMaxLatencyNum;
+
+  std::mt19937_64 rand_engine{kRandomSeed};
+  Latencies_t latencies{};
+  for (size_t i = 0; i < kMeasuredNum; ++i) {
+    SampleLatency(latencies, i, i, rand_engine);
+  }
+  ASSERT_EQ(latencies.size(), kMaxLatencyNum);
+
+  // the median of a uniform sample is close to that of all the latencies
+  const auto median = ComputePercentiles(latencies)[1];
+  EXPECT_NEAR(median, kMeasuredNum / 2, kMeasuredNum / 100);
+}
+
+}  // namespace dbgroup
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "open_loop_benchmarker.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// external sources
+#include "gtest/gtest.h"
+
+namespace dbgroup
+{
+
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kBatchSize = 3;
+constexpr size_t kExecNum = 2000;
+constexpr size_t kTimeoutInSec = 1;
+constexpr double kTargetRate = 1000;  // an operation per millisecond
+constexpr size_t kRandomSeed = 20;
+
+/*##############################################################################
+ * Classes for testing
+ *############################################################################*/
+
+/**
+ * @brief A multi read that does nothing.
+ *
+ */
+struct DummyOperation {
+  [[nodiscard]] auto
+  GetType() const  //
+      -> IndexOperation
+  {
+    return kMultiRead;
+  }
+
+  [[nodiscard]] auto
+  GetValue() const  //
+      -> uint32_t
+  {
+    return 0;
+  }
+};
+
+/**
+ * @brief An index that executes batches of multi reads instantly.
+ *
+ */
+struct DummyIndex {
+  static auto
+  GetUnitSize(  //
+      const DummyOperation *,
+      const size_t n)  //
+      -> size_t
+  {
+    return std::min(kBatchSize, n);
+  }
+
+  void
+  SetUpForWorker()
+  {
+  }
+
+  void
+  TearDownForWorker()
+  {
+  }
+
+  auto
+  Execute(const DummyOperation &)  //
+      -> size_t
+  {
+    return 1;
+  }
+
+  auto
+  ExecuteAll(  //
+      const DummyOperation *,
+      const size_t n,
+      const IndexOperation)  //
+      -> size_t
+  {
+    return n;
+  }
+};
+
+/**
+ * @brief An operation-queue that yields all the operations at once.
+ *
+ */
+struct DummyStream {
+  template <class Func>
+  void
+  ForEachChunk(Func &&func)
+  {
+    func(ops.data(), ops.size());
+  }
+
+  std::vector<DummyOperation> ops{};
+};
+
+/**
+ * @brief A generator of dummy operation-queues.
+ *
+ */
+struct DummyEngine {
+  auto
+  GenerateStream(  //
+      const size_t total_num,
+      const size_t)  //
+      -> DummyStream
+  {
+    return DummyStream{std::vector<DummyOperation>(total_num)};
+  }
+};
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(OpenLoopBenchmarkerTest, ScheduleEndingInBatchDoesNotDropOperations)
+{
+  // the schedule of one worker ends at the timeout in the middle of a batch
+  DummyIndex index{};
+  DummyEngine ops_engine{};
+  OpenLoopBenchmarker<DummyIndex, DummyEngine> bench{
+      index,       "dummy",     ops_engine, kExecNum, 1,
+      kRandomSeed, kTargetRate, false,      8,        true,
+      kTimeoutInSec};
+  testing::internal::CaptureStdout();
+  bench.Run();
+  std::istringstream results{testing::internal::GetCapturedStdout()};
+
+  // CSV: offered load, ops/s, bytes/s, dropped operations, and latencies
+  std::vector<double> fields{};
+  for (std::string field{}; std::getline(results, field, ',');) {
+    fields.emplace_back(std::stod(field));
+  }
+  ASSERT_EQ(fields.size(), 4 + kPercentileLabels.size());
+  EXPECT_EQ(fields[3], 0);
+  EXPECT_GE(fields[4], 0);  // the minimum latency is not negative
+}
+
+}  // namespace dbgroup
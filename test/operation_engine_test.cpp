@@ -17,6 +17,14 @@
 // the corresponding header
 #include "workload/operation_engine.hpp"
 
+// C++ standard libraries
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <vector>
+
 // external sources
 #include "gtest/gtest.h"
 
@@ -93,13 +101,13 @@ TEST_F(OperationEngineFixture, SinglePhaseWorkloadGenerateValidOperations)
 
   size_t counter = 0;
   for (const auto &ops : ops_engine.Generate(kOpsNumPerThread, kRandomSeed)) {
-    EXPECT_EQ(ops.type, kRead);
-    EXPECT_EQ(ops.key % 2, 0);
+    EXPECT_EQ(ops.GetType(), kRead);
+    EXPECT_EQ(ops.GetKeyID() % 2, 0);
     ++counter;
   }
   for (const auto &ops : ops_engine.Generate(kOpsNumPerThread, kRandomSeed)) {
-    EXPECT_EQ(ops.type, kRead);
-    EXPECT_EQ(ops.key % 2, 1);
+    EXPECT_EQ(ops.GetType(), kRead);
+    EXPECT_EQ(ops.GetKeyID() % 2, 1);
     ++counter;
   }
   EXPECT_EQ(counter, kRepeatNum);
@@ -140,19 +148,312 @@ TEST_F(OperationEngineFixture, MultiplePhasesWorkloadGenerateValidOperations)
 
   size_t counter = 0;
   for (const auto &ops : ops_engine.Generate(kOpsNumPerThread, kRandomSeed)) {
-    EXPECT_EQ(ops.type, (counter < kOpsNumPerThread / 2) ? kRead : kWrite);
-    EXPECT_EQ(ops.key % 2, 0);
+    EXPECT_EQ(ops.GetType(), (counter < kOpsNumPerThread / 2) ? kRead : kWrite);
+    EXPECT_EQ(ops.GetKeyID() % 2, 0);
     ++counter;
   }
   EXPECT_EQ(counter, kOpsNumPerThread);
 
   counter = 0;
   for (const auto &ops : ops_engine.Generate(kOpsNumPerThread, kRandomSeed)) {
-    EXPECT_EQ(ops.type, (counter < kOpsNumPerThread / 2) ? kRead : kWrite);
-    EXPECT_EQ(ops.key % 2, 1);
+    EXPECT_EQ(ops.GetType(), (counter < kOpsNumPerThread / 2) ? kRead : kWrite);
+    EXPECT_EQ(ops.GetKeyID() % 2, 1);
     ++counter;
   }
   EXPECT_EQ(counter, kOpsNumPerThread);
 }
 
+TEST_F(OperationEngineFixture, MaxKeyIDCoversAppendedAndAbsentKeys)
+{
+  constexpr size_t kAppendNum = 100;
+  constexpr auto kMaxKeyID = std::numeric_limits<KeyID>::max();
+
+  Json_t w_json = R"({
+    "initialization": {"# of keys": 1000},
+    "workloads": [
+      {
+        "operation ratios": {"read": 1.0},
+        "# of keys": 2000,
+        "partitioning policy": "none",
+        "access pattern": "random"
+      }
+    ]
+  })"_json;
+  ops_engine.ParseJson(w_json);
+  EXPECT_EQ(ops_engine.GetMaxKeyID(kAppendNum), 1999UL);
+
+  w_json["workloads"][0]["access pattern"] = "latest";
+  ops_engine.ParseJson(w_json);
+  EXPECT_EQ(ops_engine.GetMaxKeyID(kAppendNum), 1999UL + kAppendNum);
+  EXPECT_EQ(ops_engine.GetMaxKeyID(kMaxKeyID), kMaxKeyID);
+
+  w_json["workloads"][0]["access pattern"] = "random";
+  w_json["workloads"][0]["miss ratio"] = 0.1;
+  ops_engine.ParseJson(w_json);
+  EXPECT_EQ(ops_engine.GetMaxKeyID(kAppendNum), kMaxKeyID);
+}
+
+TEST_F(OperationEngineFixture, StreamGenerateSameOperationsAsQueue)
+{
+  Json_t w_json = R"({
+    "initialization": {
+      "# of keys": 1000000
+    },
+    "workloads": [
+      {
+        "operation ratios": {"read": 0.5, "scan": 0.5},
+        "# of keys": 1000000,
+        "partitioning policy": "none",
+        "access pattern": "random",
+        "skew parameter": 1.0,
+        "scan length": 100,
+        "execution ratio": 0.3
+      },
+      {
+        "operation ratios": {"write": 0.5, "delete": 0.5},
+        "# of keys": 1000000,
+        "partitioning policy": "none",
+        "access pattern": "random",
+        "execution ratio": 0.7
+      }
+    ]
+  })"_json;
+
+  ops_engine.ParseJson(w_json);
+
+  const auto &operations = ops_engine.Generate(kOpsNumPerThread, kRandomSeed);
+
+  // check both the prepared chunks and the ones generated on the fly
+  for (const auto stream_ops : {false, true}) {
+    if (stream_ops) {
+      ops_engine.StreamOperations();
+    }
+    auto &&stream = ops_engine.GenerateStream(kOpsNumPerThread, kRandomSeed);
+    EXPECT_EQ(stream.size(), operations.size());
+
+    size_t counter = 0;
+    for (const auto &ops : stream) {
+      ASSERT_LT(counter, operations.size());
+      const auto &expected = operations.at(counter++);
+      EXPECT_EQ(ops.GetType(), expected.GetType());
+      EXPECT_EQ(ops.GetKeyID(), expected.GetKeyID());
+      EXPECT_EQ(ops.GetValue(), expected.GetValue());
+    }
+    EXPECT_EQ(counter, kOpsNumPerThread);
+  }
+}
+
+TEST_F(OperationEngineFixture, StreamChunksBelongToOnePhase)
+{
+  Json_t w_json = R"({
+    "initialization": {
+      "# of keys": 1000000
+    },
+    "workloads": [
+      {
+        "operation ratios": {"read": 1.0},
+        "# of keys": 1000000,
+        "partitioning policy": "none",
+        "access pattern": "random",
+        "execution ratio": 0.3
+      },
+      {
+        "operation ratios": {"write": 1.0},
+        "# of keys": 1000000,
+        "partitioning policy": "none",
+        "access pattern": "random",
+        "execution ratio": 0.7
+      }
+    ]
+  })"_json;
+
+  ops_engine.ParseJson(w_json);
+
+  auto &&stream = ops_engine.GenerateStream(kOpsNumPerThread, kRandomSeed);
+  std::vector<size_t> counts(2, 0);
+  stream.ForEachChunk([&](const auto *ops, const size_t n) {
+    const auto phase = stream.GetPhase();
+    const auto single_ops = stream.GetSingleOperation();
+    EXPECT_EQ(single_ops, (phase == 0) ? kRead : kWrite);
+    for (size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(ops[i].GetType(), single_ops);
+    }
+    counts.at(phase) += n;
+  });
+  EXPECT_EQ(counts.at(0), static_cast<size_t>(kOpsNumPerThread * 0.3));
+  EXPECT_EQ(counts.at(0) + counts.at(1), kOpsNumPerThread);
+
+  // a function returning false stops the stream
+  auto &&stopped = ops_engine.GenerateStream(kOpsNumPerThread, kRandomSeed);
+  size_t chunk_num = 0;
+  stopped.ForEachChunk([&](const auto *, const size_t) { return ++chunk_num < 2; });
+  EXPECT_EQ(chunk_num, 2UL);
+}
+
+TEST_F(OperationEngineFixture, ReplayedTraceHasSameOperationsAsRecordedOnes)
+{
+  Json_t w_json = R"({
+    "initialization": {
+      "# of keys": 1000000
+    },
+    "workloads": [
+      {
+        "operation ratios": {"read": 0.5, "write": 0.5},
+        "# of keys": 1000000,
+        "partitioning policy": "stripe",
+        "access pattern": "ascending"
+      }
+    ]
+  })"_json;
+  const auto &path = std::filesystem::temp_directory_path() / "index_bench_test.trace";
+
+  // record operations of two workers
+  ops_engine.ParseJson(w_json);
+  ops_engine.RecordTrace(path);
+  const auto &recorded_0 = ops_engine.Generate(kOpsNumPerThread, kRandomSeed);
+  const auto &recorded_1 = ops_engine.Generate(kOpsNumPerThread, kRandomSeed);
+
+  // replay the recorded operations by another engine
+  OperationEngine_t replay_engine{kThreadNum};
+  replay_engine.ParseJson(w_json);
+  replay_engine.ReplayTrace(path);
+  const auto &replayed_0 = replay_engine.Generate(kOpsNumPerThread, kRandomSeed);
+  auto &&replayed_1 = replay_engine.GenerateStream(kOpsNumPerThread, kRandomSeed);
+
+  ASSERT_EQ(replayed_0.size(), recorded_0.size());
+  for (size_t i = 0; i < recorded_0.size(); ++i) {
+    EXPECT_EQ(replayed_0.at(i).GetOpsID(), recorded_0.at(i).GetOpsID());
+    EXPECT_EQ(replayed_0.at(i).GetKeyID(), recorded_0.at(i).GetKeyID());
+    EXPECT_EQ(replayed_0.at(i).GetValue(), recorded_0.at(i).GetValue());
+  }
+  size_t counter = 0;
+  for (const auto &ops : replayed_1) {
+    const auto &expected = recorded_1.at(counter++);
+    EXPECT_EQ(ops.GetOpsID(), expected.GetOpsID());
+    EXPECT_EQ(ops.GetKeyID(), expected.GetKeyID());
+    EXPECT_EQ(ops.GetValue(), expected.GetValue());
+  }
+  EXPECT_EQ(counter, kOpsNumPerThread);
+
+  std::filesystem::remove(path);
+}
+
+TEST_F(OperationEngineFixture, TraceWithOtherSettingsIsRejected)
+{
+  Json_t w_json = R"({
+    "initialization": {
+      "# of keys": 1000000
+    },
+    "workloads": [
+      {
+        "operation ratios": {"write": 1.0},
+        "# of keys": 1000000,
+        "partitioning policy": "none",
+        "access pattern": "random"
+      }
+    ]
+  })"_json;
+  const auto &path = std::filesystem::temp_directory_path() / "index_bench_test.trace";
+
+  ops_engine.ParseJson(w_json);
+  ops_engine.RecordTrace(path);
+  ops_engine.Generate(kOpsNumPerThread, kRandomSeed);
+
+  // the same operations with another key type or payload size cannot be replayed
+  OperationEngine<uint64_t, Payload_t> key_engine{kThreadNum};
+  EXPECT_THROW(key_engine.ReplayTrace(path), std::runtime_error);
+  OperationEngine<Key_t, VarLenData<k32>> payload_engine{kThreadNum};
+  EXPECT_THROW(payload_engine.ReplayTrace(path), std::runtime_error);
+
+  std::filesystem::remove(path);
+}
+
+TEST_F(OperationEngineFixture, TraceWithOtherKeyLengthsIsRejected)
+{
+  Json_t w_json = R"({
+    "initialization": {
+      "# of keys": 1000000,
+      "key length": {"uniform": {"min": 16, "max": 64}}
+    },
+    "workloads": [
+      {
+        "operation ratios": {"write": 1.0},
+        "# of keys": 1000000,
+        "partitioning policy": "none",
+        "access pattern": "random"
+      }
+    ]
+  })"_json;
+  const auto &path = std::filesystem::temp_directory_path() / "index_bench_test.trace";
+
+  OperationEngine<char *, Payload_t> var_len_engine{kThreadNum};
+  var_len_engine.ParseJson(w_json);
+  var_len_engine.RecordTrace(path);
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    var_len_engine.Generate(kOpsNumPerThread, kRandomSeed);
+  }
+
+  // the same distribution of key lengths can be replayed
+  OperationEngine<char *, Payload_t> same_engine{kThreadNum};
+  same_engine.ParseJson(w_json);
+  EXPECT_NO_THROW(same_engine.ReplayTrace(path));
+
+  // keys of other lengths cannot be replayed
+  w_json["initialization"]["key length"]["uniform"]["max"] = 128;
+  OperationEngine<char *, Payload_t> other_engine{kThreadNum};
+  other_engine.ParseJson(w_json);
+  EXPECT_THROW(other_engine.ReplayTrace(path), std::runtime_error);
+
+  std::filesystem::remove(path);
+}
+
+TEST_F(OperationEngineFixture, DurationBasedPhasesSwitchAtDeadlines)
+{
+  Json_t w_json = R"({
+    "initialization": {
+      "# of keys": 1000000
+    },
+    "workloads": [
+      {
+        "operation ratios": {"read": 1.0},
+        "# of keys": 1000000,
+        "partitioning policy": "none",
+        "access pattern": "random",
+        "duration": 0.05
+      },
+      {
+        "operation ratios": {"write": 1.0},
+        "# of keys": 1000000,
+        "partitioning policy": "none",
+        "access pattern": "random",
+        "duration": 0.05
+      }
+    ]
+  })"_json;
+
+  ops_engine.ParseJson(w_json);
+  ASSERT_TRUE(ops_engine.IsDurationBased());
+  EXPECT_THROW(ops_engine.Generate(kOpsNumPerThread, kRandomSeed), std::runtime_error);
+
+  auto &&stream = ops_engine.GenerateTimedStream(kRandomSeed);
+  const auto start = std::chrono::steady_clock::now();
+  ops_engine.GetPhaseClock()->Start();
+
+  std::array<size_t, 2> counts{};
+  size_t prev_phase = 0;
+  for (auto &&iter = stream.begin(); iter != stream.end(); ++iter) {
+    const auto phase = stream.GetPhase();
+    ASSERT_LT(phase, 2UL);
+    EXPECT_GE(phase, prev_phase);
+    EXPECT_EQ(iter->GetType(), (phase == 0) ? kRead : kWrite);
+    ++counts.at(phase);
+    prev_phase = phase;
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  EXPECT_GT(counts.at(0), 0UL);
+  EXPECT_GT(counts.at(1), 0UL);
+  EXPECT_GE(elapsed, std::chrono::milliseconds{100});
+}
+
 }  // namespace dbgroup
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "workload/rand_engine.hpp"
+
+// C++ standard libraries
+#include <array>
+#include <random>
+
+// external sources
+#include "gtest/gtest.h"
+
+namespace dbgroup
+{
+
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kRandomSeed = 20;
+
+constexpr size_t kRepeatNum = 1e6;
+
+constexpr size_t kBucketNum = 16;
+
+/*##############################################################################
+ * Fixture class definition
+ *############################################################################*/
+
+template <class RandEngine>
+class RandEngineFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+};
+
+/*##############################################################################
+ * Preparation for typed testing
+ *############################################################################*/
+
+using RandEngines = ::testing::Types<Xoshiro256PlusPlus, WyRand>;
+TYPED_TEST_SUITE(RandEngineFixture, RandEngines);
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TYPED_TEST(RandEngineFixture, SameSeedGenerateSameValues)
+{
+  TypeParam engine_a{kRandomSeed};
+  TypeParam engine_b{kRandomSeed};
+  TypeParam engine_c{kRandomSeed + 1};
+
+  size_t diff_num = 0;
+  for (size_t i = 0; i < kRepeatNum; ++i) {
+    const auto val = engine_a();
+    EXPECT_EQ(val, engine_b());
+    if (val != engine_c()) ++diff_num;
+  }
+  EXPECT_GT(diff_num, kRepeatNum - 10);
+}
+
+TYPED_TEST(RandEngineFixture, FillGenerateSameValuesAsSequentialCalls)
+{
+  constexpr auto kLaneNum = TypeParam::kLaneNum;
+
+  TypeParam engine_a{kRandomSeed};
+  TypeParam engine_b{kRandomSeed};
+  std::array<uint64_t, kLaneNum> batch{};
+  for (size_t i = 0; i < kRepeatNum / kLaneNum; ++i) {
+    engine_a.Fill(batch.data());
+    for (size_t j = 0; j < kLaneNum; ++j) {
+      EXPECT_EQ(batch.at(j), engine_b());
+    }
+  }
+}
+
+TYPED_TEST(RandEngineFixture, GeneratedValuesAreUniform)
+{
+  TypeParam engine{kRandomSeed};
+  std::uniform_int_distribution<size_t> dist{0, kBucketNum - 1};
+  std::array<size_t, kBucketNum> counts{};
+  for (size_t i = 0; i < kRepeatNum; ++i) {
+    ++counts.at(dist(engine));
+  }
+
+  // each bucket should be within 2% of the expected count
+  constexpr auto kExpected = static_cast<double>(kRepeatNum) / kBucketNum;
+  for (const auto cnt : counts) {
+    EXPECT_NEAR(cnt, kExpected, kExpected * 0.02);
+  }
+}
+
+}  // namespace dbgroup
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "workload/random_permutation.hpp"
+
+// C++ standard libraries
+#include <vector>
+
+// external sources
+#include "gtest/gtest.h"
+
+namespace dbgroup
+{
+
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kRandomSeed = 20;
+
+/*##############################################################################
+ * Utility functions
+ *############################################################################*/
+
+void
+VerifyBijection(const size_t n)
+{
+  const RandomPermutation perm{n, kRandomSeed};
+
+  std::vector<bool> visited(n, false);
+  size_t fixed_num = 0;
+  for (size_t i = 0; i < n; ++i) {
+    const auto val = perm.Permute(i);
+    ASSERT_LT(val, n);
+    EXPECT_FALSE(visited.at(val));
+    visited.at(val) = true;
+    if (val == i) ++fixed_num;
+  }
+
+  // a random permutation rarely has many fixed points
+  if (n > 100) {
+    EXPECT_LT(fixed_num, n / 100);
+  }
+}
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(RandomPermutationTest, PermuteIsBijectiveOnTinyDomains)
+{
+  for (size_t n = 1; n <= 17; ++n) {
+    VerifyBijection(n);
+  }
+}
+
+TEST(RandomPermutationTest, PermuteIsBijectiveOnLargeDomains)
+{
+  VerifyBijection(1000000);    // not a power of four
+  VerifyBijection(1UL << 20);  // a power of four
+  VerifyBijection(1000003);    // a prime number
+}
+
+TEST(RandomPermutationTest, SameSeedsProduceSamePermutations)
+{
+  constexpr size_t kDomainSize = 1000000;
+  const RandomPermutation perm_a{kDomainSize, kRandomSeed};
+  const RandomPermutation perm_b{kDomainSize, kRandomSeed};
+  const RandomPermutation perm_c{kDomainSize, kRandomSeed + 1};
+
+  size_t diff_num = 0;
+  for (size_t i = 0; i < kDomainSize; ++i) {
+    EXPECT_EQ(perm_a.Permute(i), perm_b.Permute(i));
+    if (perm_a.Permute(i) != perm_c.Permute(i)) ++diff_num;
+  }
+  EXPECT_GT(diff_num, kDomainSize / 2);
+}
+
+}  // namespace dbgroup
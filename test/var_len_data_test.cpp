@@ -66,9 +66,9 @@ class VarLenDataFixture : public ::testing::Test
 
   auto
   CreateSortedRandomUInt()  //
-      -> std::vector<uint32_t>
+      -> std::vector<KeyID>
   {
-    std::vector<uint32_t> vec;
+    std::vector<KeyID> vec;
     vec.reserve(kRepeatNum);
 
     for (size_t i = 0; i < kRepeatNum; ++i) {
@@ -130,7 +130,7 @@ class VarLenDataFixture : public ::testing::Test
   }
 
   std::mt19937_64 randome_engine_{kRandomSeed};
-  std::uniform_int_distribution<uint32_t> uint_dist_{};
+  std::uniform_int_distribution<KeyID> uint_dist_{};
 };
 
 /*##############################################################################
@@ -142,7 +142,10 @@ using TestTargets = ::testing::Types<  //
     Target<16>,
     Target<32>,
     Target<64>,
-    Target<128>>;
+    Target<128>,
+    Target<256>,
+    Target<1024>,
+    Target<4096>>;
 TYPED_TEST_SUITE(VarLenDataFixture, TestTargets);
 
 /*##############################################################################
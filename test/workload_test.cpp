@@ -18,6 +18,8 @@
 #include "workload/workload.hpp"
 
 // C++ standard libraries
+#include <algorithm>
+#include <limits>
 #include <vector>
 
 // external sources
@@ -92,8 +94,8 @@ TEST_F(WorkloadFixture, ConstructorWOArgsGenerateReadOnlyWorkload)
 
   std::vector<size_t> frequency(kDefaultKeyNum, 0);
   for (const auto &ops : operations) {
-    EXPECT_EQ(ops.type, kRead);
-    ++(frequency.at(ops.key));
+    EXPECT_EQ(ops.GetType(), kRead);
+    ++(frequency.at(ops.GetKeyID()));
   }
   std::sort(frequency.begin(), frequency.end());
   const auto err = (frequency.back() - frequency.front()) / static_cast<double>(kRepeatNum);
@@ -102,21 +104,24 @@ TEST_F(WorkloadFixture, ConstructorWOArgsGenerateReadOnlyWorkload)
 
 TEST_F(WorkloadFixture, WorkloadHavingAllOperationsGenerateOperationsUniformly)
 {  //
-  constexpr size_t kOpsTypeNum = 11;
+  constexpr size_t kOpsTypeNum = 14;
 
   Json_t w_json = R"({
     "operation ratios": {
-      "read": 0.0909,
-      "scan": 0.0909,
-      "full scan": 0.0909,
-      "write": 0.0909,
-      "insert": 0.0909,
-      "update": 0.0909,
-      "delete": 0.0909,
-      "insert or update": 0.0909,
-      "delete and insert": 0.0909,
-      "delete or insert": 0.0909,
-      "insert and delete": 0.0909
+      "read": 0.0714,
+      "scan": 0.0714,
+      "full scan": 0.0714,
+      "write": 0.0714,
+      "insert": 0.0714,
+      "update": 0.0714,
+      "delete": 0.0714,
+      "insert or update": 0.0714,
+      "delete and insert": 0.0714,
+      "delete or insert": 0.0714,
+      "insert and delete": 0.0714,
+      "read modify write": 0.0714,
+      "range scan": 0.0714,
+      "reverse scan": 0.0714
     },
     "# of keys": 1000000,
     "partitioning policy": "none",
@@ -135,7 +140,7 @@ TEST_F(WorkloadFixture, WorkloadHavingAllOperationsGenerateOperationsUniformly)
   std::array<size_t, kOpsTypeNum> frequency{};
   frequency.fill(0);
   for (const auto &ops : operations) {
-    ++(frequency.at(static_cast<size_t>(ops.type)));
+    ++(frequency.at(ops.GetOpsID()));
   }
   std::sort(frequency.begin(), frequency.end());
   const auto err = (frequency.back() - frequency.front()) / static_cast<double>(kRepeatNum);
@@ -162,7 +167,7 @@ TEST_F(WorkloadFixture, WorkloadWithSkewParameterGenerateSkewedKeys)
 
   std::vector<size_t> frequency(kDefaultKeyNum, 0);
   for (const auto &ops : operations) {
-    ++(frequency.at(ops.key));
+    ++(frequency.at(ops.GetKeyID()));
   }
   std::sort(frequency.begin(), frequency.end(), std::greater<size_t>{});
   const auto base_prob = frequency.front() / static_cast<double>(kRepeatNum);
@@ -193,7 +198,7 @@ TEST_F(WorkloadFixture, WorkloadWithRangePartitionGenerateSeparatedKeys)
   for (int64_t i = kThreadNum - 1; i >= 0; --i) {
     workload.AddOperations(operations, kOpsNumPerThread, i, kThreadNum, kRandomSeed);
     for (const auto &ops : operations) {
-      EXPECT_EQ(ops.key, --counter);
+      EXPECT_EQ(ops.GetKeyID(), --counter);
     }
     operations.clear();
   }
@@ -220,11 +225,452 @@ TEST_F(WorkloadFixture, WorkloadWithStripePartitionGenerateStripedKeys)
     workload.AddOperations(operations, kOpsNumPerThread, i, kThreadNum, kRandomSeed);
     auto counter = i;
     for (const auto &ops : operations) {
-      EXPECT_EQ(ops.key, counter);
+      EXPECT_EQ(ops.GetKeyID(), counter);
       counter += kThreadNum;
     }
     operations.clear();
   }
 }
 
+TEST_F(WorkloadFixture, RandomAccessWithPartitionCoverEachPartitionOnce)
+{  //
+  constexpr size_t kOpsNumPerThread = kDefaultKeyNum / kThreadNum;
+
+  Json_t w_json = R"({
+    "operation ratios": {"read": 1.0},
+    "# of keys": 1000000,
+    "partitioning policy": "stripe",
+    "access pattern": "random"
+  })"_json;
+
+  Workload workload{w_json};
+
+  auto &&operations = PrepareOperationVector();
+  std::vector<size_t> frequency(kDefaultKeyNum, 0);
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    workload.AddOperations(operations, kOpsNumPerThread, i, kThreadNum, kRandomSeed);
+    size_t ascending_num = 0;
+    for (size_t j = 0; j < operations.size(); ++j) {
+      const auto key = operations.at(j).GetKeyID();
+      EXPECT_EQ(key % kThreadNum, i);
+      ++(frequency.at(key));
+      if (j > 0 && key > operations.at(j - 1).GetKeyID()) ++ascending_num;
+    }
+    EXPECT_LT(ascending_num, kOpsNumPerThread * (1.0 - kAllowableError));
+    operations.clear();
+  }
+  for (const auto freq : frequency) {
+    EXPECT_EQ(freq, 1UL);
+  }
+}
+
+TEST_F(WorkloadFixture, KeysBeyondKeyIDSpaceAreRejected)
+{  //
+  constexpr size_t kLargeKeyNum = 8000000000;
+
+  Json_t w_json = R"({
+    "operation ratios": {"read": 1.0},
+    "# of keys": 8000000000,
+    "partitioning policy": "none",
+    "access pattern": "random"
+  })"_json;
+
+  if constexpr (sizeof(KeyID) < sizeof(uint64_t)) {
+    EXPECT_THROW(Workload{w_json}, std::runtime_error);
+  } else {
+    Workload workload{w_json};
+
+    auto &&operations = PrepareOperationVector();
+    workload.AddOperations(operations, kRepeatNum, 0, 1, kRandomSeed);
+    size_t large_num = 0;
+    for (const auto &ops : operations) {
+      EXPECT_LT(ops.GetKeyID(), kLargeKeyNum);
+      if (ops.GetKeyID() > std::numeric_limits<uint32_t>::max()) ++large_num;
+    }
+    EXPECT_GT(large_num, 0UL);
+  }
+}
+
+TEST_F(WorkloadFixture, LatestAccessPatternReadsRecentlyInsertedKeys)
+{  //
+  Json_t w_json = R"({
+    "operation ratios": {"read": 0.5, "insert": 0.5},
+    "# of keys": 1000000,
+    "partitioning policy": "none",
+    "access pattern": "latest",
+    "skew parameter": 1.0
+  })"_json;
+
+  Workload workload{w_json};
+
+  auto &&operations = PrepareOperationVector();
+  workload.AddOperations(operations, kRepeatNum, 0, 1, kRandomSeed);
+
+  size_t frontier = kDefaultKeyNum;
+  size_t recent_num = 0;
+  size_t read_num = 0;
+  for (const auto &ops : operations) {
+    if (ops.GetType() == kInsert) {
+      EXPECT_EQ(ops.GetKeyID(), frontier);
+      ++frontier;
+    } else {
+      ASSERT_LT(ops.GetKeyID(), frontier);
+      if (frontier - ops.GetKeyID() <= kDefaultKeyNum / 100) ++recent_num;
+      ++read_num;
+    }
+  }
+
+  // most reads should target the latest 1% keys
+  EXPECT_GT(recent_num, read_num / 2);
+}
+
+TEST_F(WorkloadFixture, LatestAccessPatternWithPartitionIsRejected)
+{  //
+  Json_t w_json = R"({
+    "operation ratios": {"read": 0.95, "insert": 0.05},
+    "# of keys": 1000000,
+    "partitioning policy": "range",
+    "access pattern": "latest"
+  })"_json;
+
+  EXPECT_THROW(Workload{w_json}, std::runtime_error);
+}
+
+TEST_F(WorkloadFixture, ScrambledZipfScatterHotKeys)
+{  //
+  Json_t w_json = R"({
+    "operation ratios": {"read": 1.0},
+    "# of keys": 1000000,
+    "partitioning policy": "none",
+    "access pattern": "random",
+    "skew parameter": 1.0
+  })"_json;
+
+  Workload zipf{w_json};
+  w_json["scrambled zipf"] = true;
+  Workload scrambled{w_json};
+
+  auto &&zipf_ops = PrepareOperationVector();
+  zipf.AddOperations(zipf_ops, kRepeatNum, 0, 1, kRandomSeed);
+  auto &&scrambled_ops = PrepareOperationVector();
+  scrambled.AddOperations(scrambled_ops, kRepeatNum, 0, 1, kRandomSeed);
+
+  std::vector<size_t> zipf_freq(kDefaultKeyNum, 0);
+  std::vector<size_t> scrambled_freq(kDefaultKeyNum, 0);
+  for (size_t i = 0; i < kRepeatNum; ++i) {
+    ++(zipf_freq.at(zipf_ops.at(i).GetKeyID()));
+    ++(scrambled_freq.at(scrambled_ops.at(i).GetKeyID()));
+  }
+
+  // the hottest keys should not be clustered at the head of the key space
+  size_t zipf_head_num = 0;
+  size_t scrambled_head_num = 0;
+  for (size_t i = 0; i < 10; ++i) {
+    zipf_head_num += zipf_freq.at(i);
+    scrambled_head_num += scrambled_freq.at(i);
+  }
+  EXPECT_LT(scrambled_head_num * 10, zipf_head_num);
+
+  // the skewness itself should be kept
+  std::sort(zipf_freq.begin(), zipf_freq.end());
+  std::sort(scrambled_freq.begin(), scrambled_freq.end());
+  EXPECT_EQ(zipf_freq, scrambled_freq);
+}
+
+TEST_F(WorkloadFixture, HotspotDriftSlideHotKeys)
+{  //
+  constexpr size_t kHotKeyNum = kDefaultKeyNum / 1000;
+
+  Json_t w_json = R"({
+    "operation ratios": {"read": 1.0},
+    "# of keys": 1000000,
+    "partitioning policy": "none",
+    "access pattern": "random",
+    "skew parameter": 1.0,
+    "hotspot drift": 1000000
+  })"_json;
+
+  Workload workload{w_json};
+
+  auto &&operations = PrepareOperationVector();
+  workload.AddOperations(operations, kRepeatNum, 0, 1, kRandomSeed);
+
+  // the hot spot should move one key per operation
+  size_t head_num = 0;
+  size_t window_num = 0;
+  for (size_t i = 0; i < kRepeatNum; ++i) {
+    const auto key = operations.at(i).GetKeyID();
+    if (key < kHotKeyNum) ++head_num;
+    if ((key + kDefaultKeyNum - i % kDefaultKeyNum) % kDefaultKeyNum < kHotKeyNum) ++window_num;
+  }
+  EXPECT_LT(head_num, kRepeatNum / 100);
+  EXPECT_GT(window_num, kRepeatNum / 3);
+}
+
+TEST_F(WorkloadFixture, MissRatioReadAbsentKeys)
+{  //
+  constexpr double kMissRatio = 0.3;
+
+  Json_t w_json = R"({
+    "operation ratios": {"read": 0.5, "write": 0.5},
+    "# of keys": 1000000,
+    "partitioning policy": "none",
+    "access pattern": "random",
+    "miss ratio": 0.3
+  })"_json;
+
+  Workload workload{w_json};
+
+  auto &&operations = PrepareOperationVector();
+  workload.AddOperations(operations, kRepeatNum, 0, 1, kRandomSeed);
+
+  // only reads should target keys beyond the loaded ones
+  constexpr auto kMinAbsentKey = std::numeric_limits<KeyID>::max() - (kDefaultKeyNum - 1);
+  size_t read_num = 0;
+  size_t miss_num = 0;
+  for (const auto &ops : operations) {
+    const auto key = ops.GetKeyID();
+    if (ops.GetType() != kRead) {
+      EXPECT_LT(key, kDefaultKeyNum);
+      continue;
+    }
+    ++read_num;
+    if (key < kDefaultKeyNum) continue;
+    EXPECT_GE(key, kMinAbsentKey);
+    ++miss_num;
+  }
+  EXPECT_NEAR(static_cast<double>(miss_num) / read_num, kMissRatio, kAllowableError);
+
+  w_json["miss ratio"] = 1.5;
+  EXPECT_THROW(Workload{w_json}, std::runtime_error);
+}
+
+TEST_F(WorkloadFixture, DistributedScanLengthsFollowGivenDistributions)
+{  //
+  Json_t w_json = R"({
+    "operation ratios": {"scan": 1.0},
+    "# of keys": 1000000,
+    "partitioning policy": "none",
+    "access pattern": "random",
+    "scan length": {"uniform": {"min": 10, "max": 20}}
+  })"_json;
+
+  // uniform lengths should be in the given range
+  Workload uniform{w_json};
+  auto &&operations = PrepareOperationVector();
+  uniform.AddOperations(operations, kRepeatNum, 0, 1, kRandomSeed);
+  for (const auto &ops : operations) {
+    EXPECT_GE(ops.GetValue(), 10UL);
+    EXPECT_LE(ops.GetValue(), 20UL);
+  }
+
+  // histogram lengths should follow the given weights
+  w_json["scan length"] = R"({"histogram": {"1": 0.7, "1000": 0.3}})"_json;
+  Workload hist{w_json};
+  operations.clear();
+  hist.AddOperations(operations, kRepeatNum, 0, 1, kRandomSeed);
+  size_t short_num = 0;
+  for (const auto &ops : operations) {
+    ASSERT_TRUE(ops.GetValue() == 1 || ops.GetValue() == 1000);
+    if (ops.GetValue() == 1) ++short_num;
+  }
+  EXPECT_NEAR(static_cast<double>(short_num) / kRepeatNum, 0.7, kAllowableError);
+
+  // Zipf lengths should make short scans frequent
+  w_json["scan length"] = R"({"zipf": {"max": 1000, "skew parameter": 1.0}})"_json;
+  Workload zipf{w_json};
+  operations.clear();
+  zipf.AddOperations(operations, kRepeatNum, 0, 1, kRandomSeed);
+  short_num = 0;
+  for (const auto &ops : operations) {
+    ASSERT_GE(ops.GetValue(), 1UL);
+    ASSERT_LE(ops.GetValue(), 1000UL);
+    if (ops.GetValue() <= 10) ++short_num;
+  }
+  EXPECT_GT(short_num, kRepeatNum / 4);
+
+  w_json["scan length"] = R"({"uniform": {"min": 20, "max": 10}})"_json;
+  EXPECT_THROW(Workload{w_json}, std::runtime_error);
+}
+
+TEST_F(WorkloadFixture, RangeAndReverseScansCarryScanLengths)
+{  //
+  Json_t w_json = R"({
+    "operation ratios": {"range scan": 0.5, "reverse scan": 0.5},
+    "# of keys": 1000000,
+    "partitioning policy": "none",
+    "access pattern": "random",
+    "scan length": {"uniform": {"min": 10, "max": 20}}
+  })"_json;
+
+  Workload workload{w_json};
+  auto &&operations = PrepareOperationVector();
+  workload.AddOperations(operations, kRepeatNum, 0, 1, kRandomSeed);
+  size_t range_num = 0;
+  for (const auto &ops : operations) {
+    ASSERT_TRUE(ops.GetType() == kRangeScan || ops.GetType() == kReverseScan);
+    EXPECT_GE(ops.GetValue(), 10UL);
+    EXPECT_LE(ops.GetValue(), 20UL);
+    if (ops.GetType() == kRangeScan) ++range_num;
+  }
+  EXPECT_NEAR(static_cast<double>(range_num) / kRepeatNum, 0.5, kAllowableError);
+
+  // range scans also need scan lengths for their spans
+  w_json.erase("scan length");
+  EXPECT_THROW(Workload{w_json}, std::exception);
+}
+
+TEST_F(WorkloadFixture, ThreadGroupsAssignOwnSettingsToWorkers)
+{  //
+  constexpr size_t kReaderNum = 3;
+  constexpr size_t kOpsNumPerThread = 1000;
+
+  Json_t w_json = R"({
+    "# of keys": 1000000,
+    "partitioning policy": "none",
+    "access pattern": "random",
+    "thread groups": [
+      {"name": "writers", "# of threads": 1, "operation ratios": {"insert": 1.0},
+       "access pattern": "ascending"},
+      {"name": "readers", "# of threads": 3, "operation ratios": {"read": 1.0},
+       "skew parameter": 1.0}
+    ]
+  })"_json;
+
+  Workload workload{w_json};
+  const auto &names = workload.GetThreadGroupNames();
+  ASSERT_EQ(names.size(), 2UL);
+  EXPECT_EQ(names.at(0), "writers");
+  EXPECT_EQ(names.at(1), "readers");
+
+  // the writer should insert keys in ascending order
+  auto &&operations = PrepareOperationVector();
+  workload.AddOperations(operations, kOpsNumPerThread, 0, kReaderNum + 1, kRandomSeed);
+  for (size_t i = 0; i < kOpsNumPerThread; ++i) {
+    EXPECT_EQ(operations.at(i).GetType(), kInsert);
+    EXPECT_EQ(operations.at(i).GetKeyID(), i);
+  }
+
+  // the readers should only read keys
+  for (size_t i = 1; i <= kReaderNum; ++i) {
+    operations.clear();
+    workload.AddOperations(operations, kOpsNumPerThread, i, kReaderNum + 1, kRandomSeed);
+    for (const auto &ops : operations) {
+      EXPECT_EQ(ops.GetType(), kRead);
+    }
+  }
+
+  // the number of workers must be the same as the threads of all the groups
+  operations.clear();
+  EXPECT_THROW(workload.AddOperations(operations, kOpsNumPerThread, 0, kReaderNum, kRandomSeed),
+               std::runtime_error);
+}
+
+TEST_F(WorkloadFixture, ThreadGroupsShareInsertFrontier)
+{  //
+  constexpr size_t kOpsNumPerThread = 1000;
+
+  Json_t w_json = R"({
+    "# of keys": 1000000,
+    "partitioning policy": "none",
+    "access pattern": "latest",
+    "skew parameter": 1.0,
+    "thread groups": [
+      {"name": "inserters", "# of threads": 1, "operation ratios": {"insert": 1.0}},
+      {"name": "readers", "# of threads": 1, "operation ratios": {"read": 1.0}}
+    ]
+  })"_json;
+
+  Workload workload{w_json};
+
+  // the inserter appends keys to the frontier
+  auto &&operations = PrepareOperationVector();
+  workload.AddOperations(operations, kOpsNumPerThread, 0, 2, kRandomSeed);
+  for (size_t i = 0; i < kOpsNumPerThread; ++i) {
+    EXPECT_EQ(operations.at(i).GetType(), kInsert);
+    EXPECT_EQ(operations.at(i).GetKeyID(), kDefaultKeyNum + i);
+  }
+
+  // the reader should see the keys inserted by the other group
+  operations.clear();
+  workload.AddOperations(operations, kOpsNumPerThread, 1, 2, kRandomSeed);
+  size_t inserted_num = 0;
+  for (const auto &ops : operations) {
+    EXPECT_EQ(ops.GetType(), kRead);
+    ASSERT_LT(ops.GetKeyID(), kDefaultKeyNum + kOpsNumPerThread);
+    if (ops.GetKeyID() >= kDefaultKeyNum) ++inserted_num;
+  }
+  EXPECT_GT(inserted_num, 0UL);
+}
+
+TEST_F(WorkloadFixture, MultiReadsAreGeneratedInBatches)
+{  //
+  constexpr size_t kOpsNum = 1000;
+
+  Json_t w_json = R"({
+    "operation ratios": {"read": 0.5, "multi read": 0.5},
+    "# of keys": 1000000,
+    "partitioning policy": "none",
+    "access pattern": "random",
+    "multi read size": 32
+  })"_json;
+
+  Workload workload{w_json};
+  auto &&operations = PrepareOperationVector();
+  workload.AddOperations(operations, kOpsNum, 0, 1, kRandomSeed);
+  size_t multi_num = 0;
+  for (size_t i = 0; i < kOpsNum;) {
+    if (operations[i].GetType() != kMultiRead) {
+      ++i;
+      continue;
+    }
+
+    // each multi read has the number of the remaining keys in its batch
+    ++multi_num;
+    EXPECT_EQ(operations[i].GetValue(), 32U);
+    for (uint32_t rem = 32; rem > 0 && i < kOpsNum; --rem, ++i) {
+      EXPECT_EQ(operations[i].GetType(), kMultiRead);
+      EXPECT_EQ(operations[i].GetValue(), rem);
+    }
+  }
+  EXPECT_GT(multi_num, 0UL);
+
+  // a batch must be read at once
+  w_json["multi read size"] = 0;
+  EXPECT_THROW(Workload{w_json}, std::runtime_error);
+  w_json["multi read size"] = kMaxMultiReadSize + 1;
+  EXPECT_THROW(Workload{w_json}, std::runtime_error);
+}
+
+TEST_F(WorkloadFixture, PhasesWithOneOperationTypeAreDetected)
+{  //
+  EXPECT_EQ(Workload{}.GetSingleOperation(), kRead);
+
+  Json_t w_json = R"({
+    "operation ratios": {"read": 0.0, "write": 1.0},
+    "# of keys": 1000000,
+    "partitioning policy": "none",
+    "access pattern": "random"
+  })"_json;
+  EXPECT_EQ(Workload{w_json}.GetSingleOperation(), kWrite);
+
+  w_json["operation ratios"]["read"] = 0.5;
+  w_json["operation ratios"]["write"] = 0.5;
+  EXPECT_EQ(Workload{w_json}.GetSingleOperation(), kUndefinedOperation);
+
+  // each thread group has its own operation types
+  w_json = R"({
+    "# of keys": 1000000,
+    "partitioning policy": "none",
+    "access pattern": "random",
+    "thread groups": [
+      {"# of threads": 1, "operation ratios": {"insert": 1.0}},
+      {"# of threads": 1, "operation ratios": {"read": 0.9, "scan": 0.1}, "scan length": 10}
+    ]
+  })"_json;
+  const Workload grouped{w_json};
+  EXPECT_EQ(grouped.GetGenerator(0, 2, kRandomSeed).GetSingleOperation(), kInsert);
+  EXPECT_EQ(grouped.GetGenerator(1, 2, kRandomSeed).GetSingleOperation(), kUndefinedOperation);
+}
+
 }  // namespace dbgroup